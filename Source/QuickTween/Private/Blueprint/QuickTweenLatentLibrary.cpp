@@ -443,7 +443,8 @@ UQuickVectorTween* UQuickTweenLatentLibrary::QuickTweenLatentMoveTo_SceneCompone
 	const FString& tweenTag,
 	bool bShouldAutoKill,
 	bool bShouldPlayWhilePaused,
-	bool bShouldAutoPlay)
+	bool bShouldAutoPlay,
+	EQuickTweenMovePolicy movePolicy)
 {
 	if (!component)
 	{
@@ -470,7 +471,9 @@ UQuickVectorTween* UQuickTweenLatentLibrary::QuickTweenLatentMoveTo_SceneCompone
 				space,
 				tweenTag,
 				bShouldAutoKill,
-				bShouldPlayWhilePaused);
+				bShouldPlayWhilePaused,
+				false,
+				movePolicy);
 
 			latentActionManager.AddNewAction(latentInfo.CallbackTarget, latentInfo.UUID, new FQuickTweenLatentAction(latentInfo, Cast<UQuickTweenBase>(tween), latentStep));
 			if (bShouldAutoPlay)
@@ -554,7 +557,8 @@ UQuickVectorTween* UQuickTweenLatentLibrary::QuickTweenLatentMoveBy_SceneCompone
 	const FString& tweenTag,
 	bool bShouldAutoKill,
 	bool bShouldPlayWhilePaused,
-	bool bShouldAutoPlay)
+	bool bShouldAutoPlay,
+	EQuickTweenMovePolicy movePolicy)
 {
 	if (!component)
 	{
@@ -581,7 +585,9 @@ UQuickVectorTween* UQuickTweenLatentLibrary::QuickTweenLatentMoveBy_SceneCompone
 				space,
 				tweenTag,
 				bShouldAutoKill,
-				bShouldPlayWhilePaused);
+				bShouldPlayWhilePaused,
+				false,
+				movePolicy);
 
 			latentActionManager.AddNewAction(latentInfo.CallbackTarget, latentInfo.UUID, new FQuickTweenLatentAction(latentInfo, Cast<UQuickTweenBase>(tween), latentStep));
 			if (bShouldAutoPlay)
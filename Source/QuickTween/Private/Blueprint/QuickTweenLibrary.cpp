@@ -4,6 +4,7 @@
 #include "Blueprint/QuickTweenLibrary.h"
 
 #include "QuickTweenManager.h"
+#include "QuickTweenGroup.h"
 #include "Camera/CameraComponent.h"
 #include "Components/CanvasPanelSlot.h"
 #include "Components/Image.h"
@@ -22,9 +23,79 @@
 #include "Engine.h"
 #include "QuickEmptyTween.h"
 #include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogQuickTweenLibrary, Log, All);
 
+static TAutoConsoleVariable<int32> CVarQuickTweenSweepInterval(
+	TEXT("QuickTween.SweepInterval"),
+	4,
+	TEXT("Frames between collision sweeps of movement tweens using the SweepEveryNFrames move policy."),
+	ECVF_Default);
+
+/** Whether a movement tween write this frame sweeps for collision under the given policy.
+ * SweepEveryNFrames offsets the sweeping frame per tween so the sweeps of many tweens spread over the interval,
+ * and always sweeps the final write so a tween never comes to rest inside geometry it skipped. */
+static bool ShouldSweep(EQuickTweenMovePolicy movePolicy, const UQuickTweenBase* tween)
+{
+	switch (movePolicy)
+	{
+	case EQuickTweenMovePolicy::Sweep:
+		return true;
+	case EQuickTweenMovePolicy::SweepEveryNFrames:
+	{
+		if (!tween || tween->GetIsCompleting())
+		{
+			return true;
+		}
+		const uint64 interval = FMath::Max(1, CVarQuickTweenSweepInterval.GetValueOnGameThread());
+		return (GFrameCounter + tween->GetUniqueID()) % interval == 0;
+	}
+	default:
+		return false;
+	}
+}
+
+/** Teleport type of a movement tween write under the given policy. */
+static ETeleportType ToTeleportType(EQuickTweenMovePolicy movePolicy)
+{
+	return movePolicy == EQuickTweenMovePolicy::TeleportPhysics ? ETeleportType::TeleportPhysics : ETeleportType::None;
+}
+
+// Target properties claimed by the library functions, material tweens claim their parameter name
+static const FName LocationChannel(TEXT("Location"));
+static const FName RotationChannel(TEXT("Rotation"));
+static const FName ScaleChannel(TEXT("Scale"));
+static const FName PositionChannel(TEXT("Position"));
+static const FName RenderScaleChannel(TEXT("RenderScale"));
+static const FName RenderAngleChannel(TEXT("RenderAngle"));
+static const FName ColorChannel(TEXT("Color"));
+static const FName OpacityChannel(TEXT("Opacity"));
+static const FName FieldOfViewChannel(TEXT("FieldOfView"));
+static const FName TargetArmLengthChannel(TEXT("TargetArmLength"));
+
+/** Register the tweened object and property so the manager kills the tween once the object dies and resolves tweens writing the same property. */
+template<typename TweenType>
+static TweenType* WithTargetProperty(TweenType* tween, UObject* target, FName channel)
+{
+	if (tween)
+	{
+		tween->SetTargetProperty(target, channel);
+	}
+	return tween;
+}
+
+/** Use the tweened component as target and as significance source so the manager can lower the update rate when it is far away. */
+template<typename TweenType>
+static TweenType* WithSignificanceSource(TweenType* tween, USceneComponent* component, FName channel)
+{
+	if (tween)
+	{
+		tween->SetSignificanceSource(component);
+	}
+	return WithTargetProperty(tween, component, channel);
+}
+
 UQuickTweenSequence* UQuickTweenLibrary::QuickTweenCreateSequence(
 	UObject* worldContextObject,
 	int32 loops,
@@ -333,7 +404,8 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenMoveTo_SceneComponent(
 	const FString& tweenTag,
 	bool bShouldAutoKill,
 	bool bShouldPlayWhilePaused,
-	bool bShouldAutoPlay)
+	bool bShouldAutoPlay,
+	EQuickTweenMovePolicy movePolicy)
 {
 	if (!component)
 	{
@@ -341,7 +413,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenMoveTo_SceneComponent(
 		return nullptr;
 	}
 
-	return UQuickVectorTween::CreateTween(
+	return WithSignificanceSource(UQuickVectorTween::CreateTween(
 		worldContextObject,
 		FNativeVectorGetter::CreateWeakLambda(component, [component = TWeakObjectPtr(component), space](UQuickVectorTween*)->FVector
 		{
@@ -356,7 +428,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenMoveTo_SceneComponent(
 				component->GetRelativeLocation();
 		}),
 		FNativeVectorGetter::CreateLambda([to](UQuickVectorTween*)->FVector{ return to; }),
-		FNativeVectorSetter::CreateWeakLambda(component, [component = TWeakObjectPtr(component), space](const FVector& v, UQuickVectorTween*)
+		FNativeVectorSetter::CreateWeakLambda(component, [component = TWeakObjectPtr(component), space, movePolicy](const FVector& v, UQuickVectorTween* tween)
 		{
 			if (!component.IsValid())
 			{
@@ -364,9 +436,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenMoveTo_SceneComponent(
 				return;
 			}
 
-			space == EQuickTweenSpace::WorldSpace ?
-				component->SetWorldLocation(v, true, nullptr, ETeleportType::None) :
-				component->SetRelativeLocation(v, true, nullptr, ETeleportType::None);
+			UQuickTweenManager::GetTransformBatch(tween).SetLocation(component.Get(), v, space, ShouldSweep(movePolicy, tween), ToTeleportType(movePolicy));
 		}),
 		duration,
 		timeScale,
@@ -378,7 +448,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenMoveTo_SceneComponent(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), component, LocationChannel);
 }
 
 UQuickVector2DTween* UQuickTweenLibrary::QuickTweenMoveTo_Widget(
@@ -402,7 +472,7 @@ UQuickVector2DTween* UQuickTweenLibrary::QuickTweenMoveTo_Widget(
 		return nullptr;
 	}
 
-	return UQuickVector2DTween::CreateTween(
+	return WithTargetProperty(UQuickVector2DTween::CreateTween(
 		worldContextObject,
 		FNativeVector2DGetter::CreateWeakLambda(widget, [widget = TWeakObjectPtr(widget)](UQuickVector2DTween*)->FVector2D
 		{
@@ -447,7 +517,7 @@ UQuickVector2DTween* UQuickTweenLibrary::QuickTweenMoveTo_Widget(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), widget, PositionChannel);
 }
 
 UQuickVectorTween* UQuickTweenLibrary::QuickTweenMoveBy_SceneComponent(
@@ -464,7 +534,8 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenMoveBy_SceneComponent(
 	const FString& tweenTag, 
 	bool bShouldAutoKill,
 	bool bShouldPlayWhilePaused,
-	bool bShouldAutoPlay)
+	bool bShouldAutoPlay,
+	EQuickTweenMovePolicy movePolicy)
 {
 	if (!component)
 	{
@@ -472,7 +543,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenMoveBy_SceneComponent(
 		return nullptr;
 	}
 
-	return UQuickVectorTween::CreateTween(
+	return WithSignificanceSource(UQuickVectorTween::CreateTween(
 		worldContextObject,
 		FNativeVectorGetter::CreateWeakLambda(component, [component = TWeakObjectPtr(component), space](UQuickVectorTween*)->FVector
 		{
@@ -487,7 +558,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenMoveBy_SceneComponent(
 				component->GetRelativeLocation();
 		}),
 		FNativeVectorGetter::CreateLambda([by](UQuickVectorTween* tween)->FVector{ return tween->GetStartValue() + by; }),
-		FNativeVectorSetter::CreateWeakLambda(component, [component = TWeakObjectPtr(component), space](const FVector& v, UQuickVectorTween*)
+		FNativeVectorSetter::CreateWeakLambda(component, [component = TWeakObjectPtr(component), space, movePolicy](const FVector& v, UQuickVectorTween* tween)
 		{
 			if (!component.IsValid())
 			{
@@ -495,9 +566,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenMoveBy_SceneComponent(
 				return;
 			}
 
-			space == EQuickTweenSpace::WorldSpace ?
-				component->SetWorldLocation(v, true, nullptr, ETeleportType::None) :
-				component->SetRelativeLocation(v, true, nullptr, ETeleportType::None);
+			UQuickTweenManager::GetTransformBatch(tween).SetLocation(component.Get(), v, space, ShouldSweep(movePolicy, tween), ToTeleportType(movePolicy));
 		}),
 		duration,
 		timeScale,
@@ -508,7 +577,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenMoveBy_SceneComponent(
 		tweenTag,
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
-		bShouldAutoPlay);
+		bShouldAutoPlay), component, LocationChannel);
 }
 
 UQuickVector2DTween* UQuickTweenLibrary::QuickTweenMoveBy_Widget(
@@ -532,7 +601,7 @@ UQuickVector2DTween* UQuickTweenLibrary::QuickTweenMoveBy_Widget(
 		return nullptr;
 	}
 
-	return UQuickVector2DTween::CreateTween(
+	return WithTargetProperty(UQuickVector2DTween::CreateTween(
 		worldContextObject,
 		FNativeVector2DGetter::CreateWeakLambda(widget, [widget = TWeakObjectPtr(widget)](UQuickVector2DTween*)->FVector2D
 		{
@@ -577,7 +646,7 @@ UQuickVector2DTween* UQuickTweenLibrary::QuickTweenMoveBy_Widget(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), widget, PositionChannel);
 }
 
 UQuickVectorTween* UQuickTweenLibrary::QuickTweenScaleTo_SceneComponent(
@@ -602,7 +671,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenScaleTo_SceneComponent(
 		return nullptr;
 	}
 
-	return UQuickVectorTween::CreateTween(
+	return WithSignificanceSource(UQuickVectorTween::CreateTween(
 		worldContextObject,
 		FNativeVectorGetter::CreateWeakLambda(component,[component = TWeakObjectPtr(component), space](UQuickVectorTween*)->FVector
 		{
@@ -617,7 +686,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenScaleTo_SceneComponent(
 				component->GetRelativeScale3D();
 		}),
 		FNativeVectorGetter::CreateLambda([to](UQuickVectorTween*)->FVector { return to; }),
-		FNativeVectorSetter::CreateWeakLambda(component, [component = TWeakObjectPtr(component), space](const FVector& v, UQuickVectorTween*)
+		FNativeVectorSetter::CreateWeakLambda(component, [component = TWeakObjectPtr(component), space](const FVector& v, UQuickVectorTween* tween)
 		{
 			if (!component.IsValid())
 			{
@@ -625,9 +694,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenScaleTo_SceneComponent(
 				return;
 			}
 
-			space == EQuickTweenSpace::WorldSpace ?
-				component->SetWorldScale3D(v) :
-				component->SetRelativeScale3D(v);
+			UQuickTweenManager::GetTransformBatch(tween).SetScale(component.Get(), v, space);
 		}),
 		duration,
 		timeScale,
@@ -639,7 +706,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenScaleTo_SceneComponent(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), component, ScaleChannel);
 }
 
 UQuickVector2DTween* UQuickTweenLibrary::QuickTweenScaleTo_Widget(
@@ -663,7 +730,7 @@ UQuickVector2DTween* UQuickTweenLibrary::QuickTweenScaleTo_Widget(
 		return nullptr;
 	}
 
-	return UQuickVector2DTween::CreateTween(
+	return WithTargetProperty(UQuickVector2DTween::CreateTween(
 		worldContextObject,
 		FNativeVector2DGetter::CreateWeakLambda(widget, [widget = TWeakObjectPtr(widget)](UQuickVector2DTween*)->FVector2D
 		{
@@ -696,7 +763,7 @@ UQuickVector2DTween* UQuickTweenLibrary::QuickTweenScaleTo_Widget(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), widget, RenderScaleChannel);
 }
 
 UQuickVectorTween* UQuickTweenLibrary::QuickTweenScaleBy_SceneComponent(
@@ -721,7 +788,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenScaleBy_SceneComponent(
 		return nullptr;
 	}
 
-	return UQuickVectorTween::CreateTween(
+	return WithSignificanceSource(UQuickVectorTween::CreateTween(
 		worldContextObject,
 		FNativeVectorGetter::CreateWeakLambda(component,[component = TWeakObjectPtr(component), space](UQuickVectorTween*)->FVector
 		{
@@ -736,7 +803,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenScaleBy_SceneComponent(
 				component->GetRelativeScale3D();
 		}),
 		FNativeVectorGetter::CreateLambda([by](UQuickVectorTween* tween)->FVector { return tween->GetStartValue() + by; }),
-		FNativeVectorSetter::CreateWeakLambda(component, [component = TWeakObjectPtr(component), space](const FVector& v, UQuickVectorTween*)
+		FNativeVectorSetter::CreateWeakLambda(component, [component = TWeakObjectPtr(component), space](const FVector& v, UQuickVectorTween* tween)
 		{
 			if (!component.IsValid())
 			{
@@ -744,9 +811,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenScaleBy_SceneComponent(
 				return;
 			}
 
-			space == EQuickTweenSpace::WorldSpace ?
-				component->SetWorldScale3D(v) :
-				component->SetRelativeScale3D(v);
+			UQuickTweenManager::GetTransformBatch(tween).SetScale(component.Get(), v, space);
 		}),
 		duration,
 		timeScale,
@@ -758,7 +823,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenScaleBy_SceneComponent(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), component, ScaleChannel);
 }
 
 UQuickVector2DTween* UQuickTweenLibrary::QuickTweenScaleBy_Widget(
@@ -782,7 +847,7 @@ UQuickVector2DTween* UQuickTweenLibrary::QuickTweenScaleBy_Widget(
 		return nullptr;
 	}
 
-	return UQuickVector2DTween::CreateTween(
+	return WithTargetProperty(UQuickVector2DTween::CreateTween(
 		worldContextObject,
 		FNativeVector2DGetter::CreateWeakLambda(widget, [widget = TWeakObjectPtr(widget)](UQuickVector2DTween*)->FVector2D
 		{
@@ -815,7 +880,7 @@ UQuickVector2DTween* UQuickTweenLibrary::QuickTweenScaleBy_Widget(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), widget, RenderScaleChannel);
 }
 
 UQuickRotatorTween* UQuickTweenLibrary::QuickTweenRotateTo_SceneComponent(
@@ -841,7 +906,7 @@ UQuickRotatorTween* UQuickTweenLibrary::QuickTweenRotateTo_SceneComponent(
 		return nullptr;
 	}
 
-	return UQuickRotatorTween::CreateTween(
+	return WithSignificanceSource(UQuickRotatorTween::CreateTween(
 		worldContextObject,
 		FNativeRotatorGetter::CreateWeakLambda(component, [component = TWeakObjectPtr(component), space](UQuickRotatorTween*)->FRotator
 		{
@@ -857,7 +922,7 @@ UQuickRotatorTween* UQuickTweenLibrary::QuickTweenRotateTo_SceneComponent(
 		}),
 		FNativeRotatorGetter::CreateLambda([to](UQuickRotatorTween*)->FRotator { return to; }),
 		bUseShortestPath,
-		FNativeRotatorSetter::CreateWeakLambda(component, [component = TWeakObjectPtr(component), space](const FRotator& v, UQuickRotatorTween*)
+		FNativeRotatorSetter::CreateWeakLambda(component, [component = TWeakObjectPtr(component), space](const FRotator& v, UQuickRotatorTween* tween)
 		{
 			if (!component.IsValid())
 			{
@@ -865,9 +930,7 @@ UQuickRotatorTween* UQuickTweenLibrary::QuickTweenRotateTo_SceneComponent(
 				return;
 			}
 
-			space == EQuickTweenSpace::WorldSpace ?
-				component->SetWorldRotation(v) :
-				component->SetRelativeRotation(v);
+			UQuickTweenManager::GetTransformBatch(tween).SetRotation(component.Get(), v, space);
 		}),
 		duration,
 		timeScale,
@@ -879,7 +942,7 @@ UQuickRotatorTween* UQuickTweenLibrary::QuickTweenRotateTo_SceneComponent(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), component, RotationChannel);
 }
 
 UQuickFloatTween* UQuickTweenLibrary::QuickTweenRotateTo_Widget(
@@ -903,7 +966,7 @@ UQuickFloatTween* UQuickTweenLibrary::QuickTweenRotateTo_Widget(
 		return nullptr;
 	}
 
-	return UQuickFloatTween::CreateTween(
+	return WithTargetProperty(UQuickFloatTween::CreateTween(
 		worldContextObject,
 		FNativeFloatGetter::CreateWeakLambda(widget, [widget = TWeakObjectPtr(widget)](UQuickFloatTween*)->float
 		{
@@ -936,7 +999,7 @@ UQuickFloatTween* UQuickTweenLibrary::QuickTweenRotateTo_Widget(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), widget, RenderAngleChannel);
 }
 
 UQuickRotatorTween* UQuickTweenLibrary::QuickTweenRotateBy_SceneComponent(
@@ -962,7 +1025,7 @@ UQuickRotatorTween* UQuickTweenLibrary::QuickTweenRotateBy_SceneComponent(
 		return nullptr;
 	}
 
-	return UQuickRotatorTween::CreateTween(
+	return WithSignificanceSource(UQuickRotatorTween::CreateTween(
 		worldContextObject,
 		FNativeRotatorGetter::CreateWeakLambda(component, [component = TWeakObjectPtr(component), space](UQuickRotatorTween*)->FRotator
 		{
@@ -991,7 +1054,7 @@ UQuickRotatorTween* UQuickTweenLibrary::QuickTweenRotateBy_SceneComponent(
 			return end.Rotator();
 		}),
 		bUseShortestPath,
-		FNativeRotatorSetter::CreateWeakLambda(component, [component = TWeakObjectPtr(component), space](const FRotator& v, UQuickRotatorTween*)
+		FNativeRotatorSetter::CreateWeakLambda(component, [component = TWeakObjectPtr(component), space](const FRotator& v, UQuickRotatorTween* tween)
 		{
 			if (!component.IsValid())
 			{
@@ -999,9 +1062,7 @@ UQuickRotatorTween* UQuickTweenLibrary::QuickTweenRotateBy_SceneComponent(
 				return;
 			}
 
-			space == EQuickTweenSpace::WorldSpace ?
-				component->SetWorldRotation(v) :
-				component->SetRelativeRotation(v);
+			UQuickTweenManager::GetTransformBatch(tween).SetRotation(component.Get(), v, space);
 		}),
 		duration,
 		timeScale,
@@ -1013,7 +1074,7 @@ UQuickRotatorTween* UQuickTweenLibrary::QuickTweenRotateBy_SceneComponent(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), component, RotationChannel);
 }
 
 UQuickFloatTween* UQuickTweenLibrary::QuickTweenRotateBy_Widget(
@@ -1037,7 +1098,7 @@ UQuickFloatTween* UQuickTweenLibrary::QuickTweenRotateBy_Widget(
 		return nullptr;
 	}
 
-	return UQuickFloatTween::CreateTween(
+	return WithTargetProperty(UQuickFloatTween::CreateTween(
 		worldContextObject,
 		FNativeFloatGetter::CreateWeakLambda(widget, [widget = TWeakObjectPtr(widget)](UQuickFloatTween*)->float
 		{
@@ -1070,7 +1131,7 @@ UQuickFloatTween* UQuickTweenLibrary::QuickTweenRotateBy_Widget(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), widget, RenderAngleChannel);
 }
 
 UQuickRotatorTween* UQuickTweenLibrary::QuickTweenLookAt_SceneComponent(
@@ -1095,7 +1156,7 @@ UQuickRotatorTween* UQuickTweenLibrary::QuickTweenLookAt_SceneComponent(
 		return nullptr;
 	}
 
-	return UQuickRotatorTween::CreateTween(
+	return WithSignificanceSource(UQuickRotatorTween::CreateTween(
 		worldContextObject,
 		FNativeRotatorGetter::CreateWeakLambda(component, [component = TWeakObjectPtr(component)](UQuickRotatorTween*)->FRotator
 		{
@@ -1120,7 +1181,7 @@ UQuickRotatorTween* UQuickTweenLibrary::QuickTweenLookAt_SceneComponent(
 			return targetRotation;
 		}),
 		bUseShortestPath,
-		FNativeRotatorSetter::CreateWeakLambda(component, [component = TWeakObjectPtr(component)](const FRotator& v, UQuickRotatorTween*)
+		FNativeRotatorSetter::CreateWeakLambda(component, [component = TWeakObjectPtr(component)](const FRotator& v, UQuickRotatorTween* tween)
 		{
 			if (!component.IsValid())
 			{
@@ -1128,7 +1189,7 @@ UQuickRotatorTween* UQuickTweenLibrary::QuickTweenLookAt_SceneComponent(
 				return;
 			}
 
-			component->SetWorldRotation(v);
+			UQuickTweenManager::GetTransformBatch(tween).SetRotation(component.Get(), v, EQuickTweenSpace::WorldSpace);
 		}),
 		duration,
 		timeScale,
@@ -1140,7 +1201,7 @@ UQuickRotatorTween* UQuickTweenLibrary::QuickTweenLookAt_SceneComponent(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), component, RotationChannel);
 }
 
 UQuickFloatTween* UQuickTweenLibrary::QuickTweenRotateAroundPoint_SceneComponent(
@@ -1175,7 +1236,7 @@ UQuickFloatTween* UQuickTweenLibrary::QuickTweenRotateAroundPoint_SceneComponent
 
 	TSharedPtr<FStartPosHolder> startPosPtr = MakeShared<FStartPosHolder>();
 
-	return UQuickFloatTween::CreateTween(
+	return WithSignificanceSource(UQuickFloatTween::CreateTween(
 		worldContextObject,
 		FNativeFloatGetter::CreateLambda([from](UQuickFloatTween*)->float
 		{
@@ -1202,7 +1263,7 @@ UQuickFloatTween* UQuickTweenLibrary::QuickTweenRotateAroundPoint_SceneComponent
 
 			const FVector dirFromPoint = (startPosPtr->Start - point);
 			const FVector rotatedPosition = point + dirFromPoint.RotateAngleAxis(v, normal.GetSafeNormal());
-			component->SetWorldLocation(rotatedPosition);
+			UQuickTweenManager::GetTransformBatch(tween).SetLocation(component.Get(), rotatedPosition, EQuickTweenSpace::WorldSpace);
 		}),
 		duration,
 		timeScale,
@@ -1214,7 +1275,7 @@ UQuickFloatTween* UQuickTweenLibrary::QuickTweenRotateAroundPoint_SceneComponent
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), component, LocationChannel);
 }
 
 UQuickColorTween* UQuickTweenLibrary::QuickTweenChangeColorTo_Image(
@@ -1238,7 +1299,7 @@ UQuickColorTween* UQuickTweenLibrary::QuickTweenChangeColorTo_Image(
 		return nullptr;
 	}
 
-	return UQuickColorTween::CreateTween(
+	return WithTargetProperty(UQuickColorTween::CreateTween(
 		worldContextObject,
 		FNativeColorGetter::CreateWeakLambda(widget, [widget = TWeakObjectPtr(widget)](UQuickColorTween*)->FColor
 		{
@@ -1271,7 +1332,7 @@ UQuickColorTween* UQuickTweenLibrary::QuickTweenChangeColorTo_Image(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), widget, ColorChannel);
 }
 
 UQuickFloatTween* UQuickTweenLibrary::QuickTweenChangeOpacityTo_Widget(
@@ -1295,7 +1356,7 @@ UQuickFloatTween* UQuickTweenLibrary::QuickTweenChangeOpacityTo_Widget(
 		return nullptr;
 	}
 
-	return UQuickFloatTween::CreateTween(
+	return WithTargetProperty(UQuickFloatTween::CreateTween(
 		worldContextObject,
 		FNativeFloatGetter::CreateWeakLambda(widget, [widget = TWeakObjectPtr(widget)](UQuickFloatTween*)->float
 		{
@@ -1328,7 +1389,7 @@ UQuickFloatTween* UQuickTweenLibrary::QuickTweenChangeOpacityTo_Widget(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), widget, OpacityChannel);
 }
 
 UQuickFloatTween* UQuickTweenLibrary::QuickTweenChangeFovTo_Camera(
@@ -1352,7 +1413,7 @@ UQuickFloatTween* UQuickTweenLibrary::QuickTweenChangeFovTo_Camera(
 		return nullptr;
 	}
 
-	return UQuickFloatTween::CreateTween(
+	return WithTargetProperty(UQuickFloatTween::CreateTween(
 		worldContextObject,
 		FNativeFloatGetter::CreateWeakLambda(camera, [camera = TWeakObjectPtr(camera)](UQuickFloatTween*)->float
 		{
@@ -1385,7 +1446,7 @@ UQuickFloatTween* UQuickTweenLibrary::QuickTweenChangeFovTo_Camera(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), camera, FieldOfViewChannel);
 }
 
 UQuickFloatTween* UQuickTweenLibrary::QuickTweenChangeDistanceTo_SpringArm(
@@ -1409,7 +1470,7 @@ UQuickFloatTween* UQuickTweenLibrary::QuickTweenChangeDistanceTo_SpringArm(
 		return nullptr;
 	}
 
-	return UQuickFloatTween::CreateTween(
+	return WithTargetProperty(UQuickFloatTween::CreateTween(
 		worldContextObject,
 		FNativeFloatGetter::CreateWeakLambda(springArm, [springArm = TWeakObjectPtr(springArm)](UQuickFloatTween*)->float
 		{
@@ -1442,7 +1503,7 @@ UQuickFloatTween* UQuickTweenLibrary::QuickTweenChangeDistanceTo_SpringArm(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), springArm, TargetArmLengthChannel);
 }
 
 UQuickFloatTween* UQuickTweenLibrary::QuickTweenChangeDistanceBy_SpringArm(
@@ -1466,7 +1527,7 @@ UQuickFloatTween* UQuickTweenLibrary::QuickTweenChangeDistanceBy_SpringArm(
 		return nullptr;
 	}
 
-	return UQuickFloatTween::CreateTween(
+	return WithTargetProperty(UQuickFloatTween::CreateTween(
 		worldContextObject,
 		FNativeFloatGetter::CreateWeakLambda(springArm, [springArm = TWeakObjectPtr(springArm)](UQuickFloatTween*)->float
 		{
@@ -1499,7 +1560,7 @@ UQuickFloatTween* UQuickTweenLibrary::QuickTweenChangeDistanceBy_SpringArm(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), springArm, TargetArmLengthChannel);
 }
 
 UQuickVectorTween* UQuickTweenLibrary::QuickTweenVectorParameterTo_Material(
@@ -1524,7 +1585,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenVectorParameterTo_Material(
 		return nullptr;
 	}
 
-	return UQuickVectorTween::CreateTween(
+	return WithTargetProperty(UQuickVectorTween::CreateTween(
 		worldContextObject,
 		FNativeVectorGetter::CreateWeakLambda(material, [material = TWeakObjectPtr(material), parameterName](UQuickVectorTween*)->FVector
 		{
@@ -1559,7 +1620,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenVectorParameterTo_Material(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), material, parameterName);
 }
 
 UQuickVectorTween* UQuickTweenLibrary::QuickTweenVectorParameterBy_Material(
@@ -1584,7 +1645,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenVectorParameterBy_Material(
 		return nullptr;
 	}
 
-	return UQuickVectorTween::CreateTween(
+	return WithTargetProperty(UQuickVectorTween::CreateTween(
 		worldContextObject,
 		FNativeVectorGetter::CreateWeakLambda(material, [material = TWeakObjectPtr(material), parameterName](UQuickVectorTween*)->FVector
 		{
@@ -1619,7 +1680,7 @@ UQuickVectorTween* UQuickTweenLibrary::QuickTweenVectorParameterBy_Material(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), material, parameterName);
 }
 
 UQuickFloatTween* UQuickTweenLibrary::QuickTweenScalarParameterTo_Material(
@@ -1644,7 +1705,7 @@ UQuickFloatTween* UQuickTweenLibrary::QuickTweenScalarParameterTo_Material(
 		return nullptr;
 	}
 
-	return UQuickFloatTween::CreateTween(
+	return WithTargetProperty(UQuickFloatTween::CreateTween(
 		worldContextObject,
 		FNativeFloatGetter::CreateWeakLambda(material, [material = TWeakObjectPtr(material), parameterName](UQuickFloatTween*)->float
 		{
@@ -1679,7 +1740,7 @@ UQuickFloatTween* UQuickTweenLibrary::QuickTweenScalarParameterTo_Material(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), material, parameterName);
 }
 
 UQuickFloatTween* UQuickTweenLibrary::QuickTweenScalarParameterBy_Material(
@@ -1704,7 +1765,7 @@ UQuickFloatTween* UQuickTweenLibrary::QuickTweenScalarParameterBy_Material(
 		return nullptr;
 	}
 
-	return UQuickFloatTween::CreateTween(
+	return WithTargetProperty(UQuickFloatTween::CreateTween(
 		worldContextObject,
 		FNativeFloatGetter::CreateWeakLambda(material, [material = TWeakObjectPtr(material), parameterName](UQuickFloatTween*)->float
 		{
@@ -1739,7 +1800,7 @@ UQuickFloatTween* UQuickTweenLibrary::QuickTweenScalarParameterBy_Material(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), material, parameterName);
 }
 
 UQuickColorTween* UQuickTweenLibrary::QuickTweenColorParameterTo_Material(
@@ -1764,7 +1825,7 @@ UQuickColorTween* UQuickTweenLibrary::QuickTweenColorParameterTo_Material(
 		return nullptr;
 	}
 
-	return UQuickColorTween::CreateTween(
+	return WithTargetProperty(UQuickColorTween::CreateTween(
 		worldContextObject,
 		FNativeColorGetter::CreateWeakLambda(material, [material = TWeakObjectPtr(material), parameterName](UQuickColorTween*)->FColor
 		{
@@ -1799,7 +1860,7 @@ UQuickColorTween* UQuickTweenLibrary::QuickTweenColorParameterTo_Material(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), material, parameterName);
 }
 
 UQuickColorTween* UQuickTweenLibrary::QuickTweenColorParameterBy_Material(
@@ -1824,7 +1885,7 @@ UQuickColorTween* UQuickTweenLibrary::QuickTweenColorParameterBy_Material(
 		return nullptr;
 	}
 
-	return UQuickColorTween::CreateTween(
+	return WithTargetProperty(UQuickColorTween::CreateTween(
 		worldContextObject,
 		FNativeColorGetter::CreateWeakLambda(material, [material = TWeakObjectPtr(material), parameterName](UQuickColorTween*)->FColor
 		{
@@ -1868,7 +1929,7 @@ UQuickColorTween* UQuickTweenLibrary::QuickTweenColorParameterBy_Material(
 		bShouldAutoKill,
 		bShouldPlayWhilePaused,
 		bShouldAutoPlay
-	);
+	), material, parameterName);
 }
 
 
@@ -1882,16 +1943,41 @@ UQuickTweenable* UQuickTweenLibrary::QuickTweenFindTweenByTag(const UObject* wor
 
 	if (UQuickTweenManager* manager = UQuickTweenManager::Get(worldContextObject))
 	{
-		return manager->FindTweenByPredicate([&tweenTag](const UQuickTweenable* tween)->bool
-		{
-			return tween->GetTweenTag().Equals(tweenTag, ESearchCase::CaseSensitive);
-		});
+		// ... a tag that was never turned into a name can't be indexed
+		const FName tagName(*tweenTag, FNAME_Find);
+		return tagName.IsNone() ? nullptr : manager->FindTweenByTag(tagName);
 	}
 
 	UE_LOG(LogQuickTweenLibrary, Warning, TEXT("QuickTweenFindByTag: Failed to get QuickTweenManager."));
 	return nullptr;
 }
 
+TArray<UQuickTweenable*> UQuickTweenLibrary::QuickTweenFindAllTweensByTag(
+	const UObject* worldContextObject,
+	const FString& tweenTag,
+	bool bMatchChildTags)
+{
+	TArray<UQuickTweenable*> tweens;
+	if (tweenTag.IsEmpty())
+	{
+		UE_LOG(LogQuickTweenLibrary, Warning, TEXT("QuickTweenFindAllTweensByTag: Tween tag is empty."));
+		return tweens;
+	}
+
+	if (UQuickTweenManager* manager = UQuickTweenManager::Get(worldContextObject))
+	{
+		const FName tagName(*tweenTag, FNAME_Find);
+		if (!tagName.IsNone())
+		{
+			manager->FindAllTweensByTag(tagName, tweens, bMatchChildTags);
+		}
+		return tweens;
+	}
+
+	UE_LOG(LogQuickTweenLibrary, Warning, TEXT("QuickTweenFindAllTweensByTag: Failed to get QuickTweenManager."));
+	return tweens;
+}
+
 TArray<UQuickTweenable*> UQuickTweenLibrary::QuickTweenFindAllTweensByPredicate(
 	const UObject* worldContextObject,
 	const FQuickConstTweenableAction& predicate)
@@ -1919,6 +2005,26 @@ void UQuickTweenLibrary::QuickTweenKillAllTweens(const UObject* worldContextObje
 	UE_LOG(LogQuickTweenLibrary, Warning, TEXT("QuickTweenKillAllTweens: Failed to get QuickTweenManager."));
 }
 
+int32 UQuickTweenLibrary::QuickTweenKillTweensOf(const UObject* worldContextObject, const UObject* target)
+{
+	if (UQuickTweenManager* manager = UQuickTweenManager::Get(worldContextObject))
+	{
+		return manager->KillTweensOf(target);
+	}
+	UE_LOG(LogQuickTweenLibrary, Warning, TEXT("QuickTweenKillTweensOf: Failed to get QuickTweenManager."));
+	return 0;
+}
+
+UQuickTweenGroup* UQuickTweenLibrary::QuickTweenCreateGroup(const UObject* worldContextObject, FName groupName)
+{
+	if (UQuickTweenManager* manager = UQuickTweenManager::Get(worldContextObject))
+	{
+		return manager->CreateGroup(groupName);
+	}
+	UE_LOG(LogQuickTweenLibrary, Warning, TEXT("QuickTweenCreateGroup: Failed to get QuickTweenManager."));
+	return nullptr;
+}
+
 void UQuickTweenLibrary::QuickTweenPauseAllTweens(const UObject* worldContextObject)
 {
 	if (UQuickTweenManager* manager = UQuickTweenManager::Get(worldContextObject))
@@ -1988,3 +2094,129 @@ void UQuickTweenLibrary::QuickTweenExecuteActionByPredicate(
 	}
 	UE_LOG(LogQuickTweenLibrary, Warning, TEXT("QuickTweenExecuteActionByPredicate: Failed to get QuickTweenManager."));
 }
+
+void UQuickTweenLibrary::QuickTweenPlayHandle(const FQuickTweenHandle& handle)
+{
+	handle.Play();
+}
+
+void UQuickTweenLibrary::QuickTweenPauseHandle(const FQuickTweenHandle& handle)
+{
+	handle.Pause();
+}
+
+void UQuickTweenLibrary::QuickTweenKillHandle(const FQuickTweenHandle& handle)
+{
+	handle.Kill();
+}
+
+bool UQuickTweenLibrary::QuickTweenIsHandleAlive(const FQuickTweenHandle& handle)
+{
+	return handle.IsAlive();
+}
+
+float UQuickTweenLibrary::QuickTweenGetHandleElapsedTime(const FQuickTweenHandle& handle)
+{
+	return handle.GetElapsedTime();
+}
+
+UQuickTweenable* UQuickTweenLibrary::QuickTweenResolveHandle(const FQuickTweenHandle& handle)
+{
+	return handle.Get();
+}
+
+void UQuickTweenLibrary::QuickTweenPrewarmPool(
+	const UObject* worldContextObject,
+	TSubclassOf<UQuickTweenable> tweenClass,
+	int32 count)
+{
+	if (UQuickTweenManager* manager = UQuickTweenManager::Get(worldContextObject))
+	{
+		manager->PrewarmPool(tweenClass, count);
+		return;
+	}
+	UE_LOG(LogQuickTweenLibrary, Warning, TEXT("QuickTweenPrewarmPool: Failed to get QuickTweenManager."));
+}
+
+FQuickTweenPoolStats UQuickTweenLibrary::QuickTweenGetPoolStats(
+	const UObject* worldContextObject,
+	TSubclassOf<UQuickTweenable> tweenClass)
+{
+	if (UQuickTweenManager* manager = UQuickTweenManager::Get(worldContextObject))
+	{
+		const FQuickTweenPoolStats* stats = manager->FindPoolStats(tweenClass);
+		return stats ? *stats : FQuickTweenPoolStats();
+	}
+	UE_LOG(LogQuickTweenLibrary, Warning, TEXT("QuickTweenGetPoolStats: Failed to get QuickTweenManager."));
+	return FQuickTweenPoolStats();
+}
+
+FQuickTweenBudgetStats UQuickTweenLibrary::QuickTweenGetBudgetStats(const UObject* worldContextObject)
+{
+	if (UQuickTweenManager* manager = UQuickTweenManager::Get(worldContextObject))
+	{
+		return manager->GetBudgetStats();
+	}
+	UE_LOG(LogQuickTweenLibrary, Warning, TEXT("QuickTweenGetBudgetStats: Failed to get QuickTweenManager."));
+	return FQuickTweenBudgetStats();
+}
+
+void UQuickTweenLibrary::QuickTweenSetTimeChannelScale(const UObject* worldContextObject, FName channel, float timeScale)
+{
+	if (UQuickTweenManager* manager = UQuickTweenManager::Get(worldContextObject))
+	{
+		manager->SetTimeChannelScale(channel, timeScale);
+		return;
+	}
+	UE_LOG(LogQuickTweenLibrary, Warning, TEXT("QuickTweenSetTimeChannelScale: Failed to get QuickTweenManager."));
+}
+
+void UQuickTweenLibrary::QuickTweenSetTimeChannelPaused(const UObject* worldContextObject, FName channel, bool bPaused)
+{
+	if (UQuickTweenManager* manager = UQuickTweenManager::Get(worldContextObject))
+	{
+		manager->SetTimeChannelPaused(channel, bPaused);
+		return;
+	}
+	UE_LOG(LogQuickTweenLibrary, Warning, TEXT("QuickTweenSetTimeChannelPaused: Failed to get QuickTweenManager."));
+}
+
+float UQuickTweenLibrary::QuickTweenGetTimeChannelScale(const UObject* worldContextObject, FName channel)
+{
+	if (UQuickTweenManager* manager = UQuickTweenManager::Get(worldContextObject))
+	{
+		return manager->GetTimeChannelScale(channel);
+	}
+	UE_LOG(LogQuickTweenLibrary, Warning, TEXT("QuickTweenGetTimeChannelScale: Failed to get QuickTweenManager."));
+	return 1.0f;
+}
+
+bool UQuickTweenLibrary::QuickTweenIsTimeChannelPaused(const UObject* worldContextObject, FName channel)
+{
+	if (UQuickTweenManager* manager = UQuickTweenManager::Get(worldContextObject))
+	{
+		return manager->IsTimeChannelPaused(channel);
+	}
+	UE_LOG(LogQuickTweenLibrary, Warning, TEXT("QuickTweenIsTimeChannelPaused: Failed to get QuickTweenManager."));
+	return false;
+}
+
+void UQuickTweenLibrary::QuickTweenSetConflictPolicy(const UObject* worldContextObject, EQuickTweenConflictPolicy policy)
+{
+	if (UQuickTweenManager* manager = UQuickTweenManager::Get(worldContextObject))
+	{
+		manager->SetConflictPolicy(policy);
+		return;
+	}
+	UE_LOG(LogQuickTweenLibrary, Warning, TEXT("QuickTweenSetConflictPolicy: Failed to get QuickTweenManager."));
+}
+
+EQuickTweenConflictPolicy UQuickTweenLibrary::QuickTweenGetConflictPolicy(const UObject* worldContextObject)
+{
+	if (UQuickTweenManager* manager = UQuickTweenManager::Get(worldContextObject))
+	{
+		return manager->GetConflictPolicy();
+	}
+	UE_LOG(LogQuickTweenLibrary, Warning, TEXT("QuickTweenGetConflictPolicy: Failed to get QuickTweenManager."));
+	return EQuickTweenConflictPolicy::Ignore;
+}
@@ -0,0 +1,196 @@
+﻿// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+
+#include "QuickNativeTween.h"
+#include "Async/ParallelFor.h"
+#include "Utils/QuickTweenTiming.h"
+
+void FQuickNativeTween::Play()
+{
+	if (State == EQuickTweenState::Idle)
+	{
+		ElapsedTime = bIsReversed ? GetTotalDuration() : 0.0f;
+		State = EQuickTweenState::Play;
+	}
+	else if (State == EQuickTweenState::Pause)
+	{
+		State = EQuickTweenState::Play;
+	}
+}
+
+void FQuickNativeTween::Pause()
+{
+	if (State == EQuickTweenState::Play)
+	{
+		State = EQuickTweenState::Pause;
+	}
+}
+
+FQuickNativeTweenHandle FQuickNativeTweenStorage::Add(TFunction<void(float)> setter, FQuickNativeTweenParams params)
+{
+	check(IsInGameThread());
+
+	FQuickNativeTween tween;
+	tween.Setter = MoveTemp(setter);
+	tween.OnComplete = MoveTemp(params.OnComplete);
+	tween.Duration = params.Duration > 0.0f ? params.Duration : 1.0f;
+	tween.TimeScale = params.TimeScale;
+	tween.Loops = params.Loops;
+	tween.LoopType = params.LoopType;
+	tween.EaseType = params.EaseType;
+	tween.bPlayWhilePaused = params.bPlayWhilePaused;
+	if (params.bAutoPlay)
+	{
+		tween.Play();
+	}
+
+	// ... 0 marks an unset handle
+	if (++LastGeneration == 0)
+	{
+		++LastGeneration;
+	}
+
+	FQuickNativeTweenHandle handle;
+	handle.Slot = FreeSlots.IsEmpty() ? Slots.AddDefaulted() : FreeSlots.Pop(EAllowShrinking::No);
+	handle.Generation = LastGeneration;
+	tween.Slot = handle.Slot;
+
+	// ... Tweens must not move while the tick pass holds references into it
+	FSlot& slot = Slots[handle.Slot];
+	slot.Generation = handle.Generation;
+	slot.bIsPending = bIsTicking;
+	slot.Index = bIsTicking ? PendingTweens.Add(MoveTemp(tween)) : Tweens.Add(MoveTemp(tween));
+	return handle;
+}
+
+FQuickNativeTween* FQuickNativeTweenStorage::Find(const FQuickNativeTweenHandle& handle)
+{
+	if (!handle.IsSet() || !Slots.IsValidIndex(handle.Slot))
+	{
+		return nullptr;
+	}
+
+	const FSlot& slot = Slots[handle.Slot];
+	if (slot.Generation != handle.Generation)
+	{
+		return nullptr;
+	}
+
+	FQuickNativeTween& tween = slot.bIsPending ? PendingTweens[slot.Index] : Tweens[slot.Index];
+	return tween.State == EQuickTweenState::Kill ? nullptr : &tween;
+}
+
+void FQuickNativeTweenStorage::Tick(float deltaTime, bool bIsWorldPaused, bool bForceSerial, int32 minBatchSize)
+{
+	check(!bIsTicking);
+	bIsTicking = true;
+
+	// ... compute pass: time, loop and easing, pure math on worker threads
+	ParallelFor(
+		TEXT("QuickTween.NativeCompute"),
+		Tweens.Num(),
+		minBatchSize,
+		[this, deltaTime, bIsWorldPaused](int32 index)
+		{
+			FQuickNativeTween& tween = Tweens[index];
+			tween.bHasUpdate = false;
+			if (tween.State != EQuickTweenState::Play || (bIsWorldPaused && !tween.bPlayWhilePaused))
+			{
+				return;
+			}
+
+			tween.ElapsedTime += (tween.bIsReversed ? -1.f : 1.f) * deltaTime * tween.TimeScale; // ... we allow overflow to handle completion properly
+			const FQuickTweenStateResult state = FQuickTweenTiming::ComputeState(tween.ElapsedTime, tween.Duration, tween.LoopType);
+
+			tween.bHasCompleted = tween.Loops != INFINITE_LOOPS &&
+				((!tween.bIsReversed && state.Loop >= tween.Loops) || (tween.bIsReversed && tween.ElapsedTime < 0.0f));
+			if (tween.bHasCompleted)
+			{
+				// ... same snapping rules as the typed tweens: reversed or even ping-pong ends at the start
+				const bool bSnapToBeginning = tween.bIsReversed || (tween.LoopType == ELoopType::PingPong && tween.Loops % 2 == 0);
+				tween.EasedAlpha = bSnapToBeginning ? 0.0f : 1.0f;
+			}
+			else
+			{
+				tween.EasedAlpha = FQuickTweenTiming::EaseAlpha(state.Alpha, tween.EaseType, nullptr);
+			}
+			tween.bHasUpdate = true;
+		},
+		bForceSerial ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+	// ... apply pass: setters and completion callbacks
+	for (FQuickNativeTween& tween : Tweens)
+	{
+		// ... an earlier callback this frame may have paused or killed it
+		if (!tween.bHasUpdate || tween.State != EQuickTweenState::Play)
+		{
+			continue;
+		}
+
+		tween.Setter(tween.EasedAlpha);
+		if (tween.bHasCompleted && tween.State == EQuickTweenState::Play)
+		{
+			tween.State = EQuickTweenState::Kill;
+			if (tween.OnComplete)
+			{
+				tween.OnComplete();
+			}
+		}
+	}
+
+	bIsTicking = false;
+	Compact();
+	FlushPending();
+}
+
+void FQuickNativeTweenStorage::Reset()
+{
+	check(!bIsTicking);
+
+	Tweens.Reset();
+	PendingTweens.Reset();
+	Slots.Reset();
+	FreeSlots.Reset();
+}
+
+void FQuickNativeTweenStorage::FreeSlot(int32 slot)
+{
+	Slots[slot] = FSlot();
+	FreeSlots.Add(slot);
+}
+
+void FQuickNativeTweenStorage::Compact()
+{
+	for (int32 index = Tweens.Num() - 1; index >= 0; --index)
+	{
+		if (Tweens[index].State != EQuickTweenState::Kill)
+		{
+			continue;
+		}
+
+		FreeSlot(Tweens[index].Slot);
+		Tweens.RemoveAtSwap(index, 1, EAllowShrinking::No);
+
+		// ... the last tween was moved into the freed index
+		if (Tweens.IsValidIndex(index))
+		{
+			Slots[Tweens[index].Slot].Index = index;
+		}
+	}
+}
+
+void FQuickNativeTweenStorage::FlushPending()
+{
+	for (FQuickNativeTween& tween : PendingTweens)
+	{
+		if (tween.State == EQuickTweenState::Kill)
+		{
+			FreeSlot(tween.Slot);
+			continue;
+		}
+
+		FSlot& slot = Slots[tween.Slot];
+		slot.bIsPending = false;
+		slot.Index = Tweens.Add(MoveTemp(tween));
+	}
+	PendingTweens.Reset();
+}
@@ -1,5 +1,21 @@
 // Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
+#include "QuickTweenStats.h"
+
+DEFINE_STAT(STAT_QuickTween_Advance);
+DEFINE_STAT(STAT_QuickTween_Ease);
+DEFINE_STAT(STAT_QuickTween_Setters);
+DEFINE_STAT(STAT_QuickTween_Events);
+DEFINE_STAT(STAT_QuickTween_SequenceSeek);
+DEFINE_STAT(STAT_QuickTween_Compaction);
+
+DEFINE_STAT(STAT_QuickTween_NumActive);
+DEFINE_STAT(STAT_QuickTween_NumPlaying);
+DEFINE_STAT(STAT_QuickTween_NumPaused);
+DEFINE_STAT(STAT_QuickTween_NumIdle);
+DEFINE_STAT(STAT_QuickTween_NumCreated);
+DEFINE_STAT(STAT_QuickTween_NumKilled);
+DEFINE_STAT(STAT_QuickTween_NumPoolHits);
 	
 IMPLEMENT_MODULE(FDefaultModuleImpl, QuickTween)
\ No newline at end of file
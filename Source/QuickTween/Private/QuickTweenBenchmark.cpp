@@ -0,0 +1,250 @@
+﻿// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "QuickTweenManager.h"
+#include "Tweens/QuickFloatTween.h"
+#include "Tweens/QuickVectorTween.h"
+#include "Tweens/QuickRotatorTween.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformMemory.h"
+#include "Math/RandomStream.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogQuickTweenBenchmark, Log, All);
+
+// Tag of every benchmark tween, so the run can clean up after itself
+static const TCHAR* BenchmarkTag = TEXT("QuickTween.Benchmark");
+
+// Frame delta the manager is ticked with, 60 Hz
+static constexpr float BenchmarkDeltaTime = 1.0f / 60.0f;
+
+// Seed of the state, loop and ease mix so every run creates the same tweens
+static constexpr int32 BenchmarkSeed = 0x5EED;
+
+// Frames the manager is ticked for per case
+static constexpr int32 BenchmarkFrames = 120;
+
+// Tween counts of the cases
+static constexpr int32 BenchmarkCounts[] = { 1000, 10000, 100000 };
+
+struct FQuickTweenBenchmarkResult
+{
+	int32 NumTweens = 0;
+	int32 NumFrames = 0;
+	double CreateMs = 0.0;
+	double TickMeanMs = 0.0;
+	double TickMedianMs = 0.0;
+	double TickP95Ms = 0.0;
+	double TickMaxMs = 0.0;
+	SIZE_T ObjectBytes = 0;
+	SIZE_T ContainerBytes = 0;
+	int64 UsedPhysicalBytes = 0;
+	int32 NumNotReleased = 0;
+};
+
+// Setters write somewhere observable so the work isn't optimized away
+static float FloatSink = 0.0f;
+static FVector VectorSink = FVector::ZeroVector;
+static FRotator RotatorSink = FRotator::ZeroRotator;
+
+static UQuickTweenBase* CreateBenchmarkTween(UWorld* world, int32 index, FRandomStream& random)
+{
+	const int32 numEaseTypes = static_cast<int32>(EEaseType::InOutBounce) + 1;
+	const EEaseType easeType = static_cast<EEaseType>(random.RandHelper(numEaseTypes));
+	const float duration = random.FRandRange(0.5f, 4.0f);
+	const ELoopType loopType = random.RandHelper(2) == 0 ? ELoopType::Restart : ELoopType::PingPong;
+
+	// ... a quarter play once, the rest loop a few times or forever
+	const int32 loopRoll = random.RandHelper(4);
+	const int32 loops = loopRoll == 0 ? 1 : loopRoll == 1 ? 3 : INFINITE_LOOPS;
+	const FString tag = BenchmarkTag;
+
+	switch (index % 3)
+	{
+	case 0:
+		return UQuickFloatTween::CreateTween(
+			world,
+			FNativeFloatGetter::CreateLambda([](UQuickFloatTween*) { return 0.0f; }),
+			FNativeFloatGetter::CreateLambda([](UQuickFloatTween*) { return 100.0f; }),
+			FNativeFloatSetter::CreateLambda([](const float value, UQuickFloatTween*) { FloatSink = value; }),
+			duration, 1.0f, easeType, nullptr, loops, loopType, tag, false);
+	case 1:
+		return UQuickVectorTween::CreateTween(
+			world,
+			FNativeVectorGetter::CreateLambda([](UQuickVectorTween*) { return FVector::ZeroVector; }),
+			FNativeVectorGetter::CreateLambda([](UQuickVectorTween*) { return FVector(100.0); }),
+			FNativeVectorSetter::CreateLambda([](const FVector& value, UQuickVectorTween*) { VectorSink = value; }),
+			duration, 1.0f, easeType, nullptr, loops, loopType, tag, false);
+	default:
+		return UQuickRotatorTween::CreateTween(
+			world,
+			FNativeRotatorGetter::CreateLambda([](UQuickRotatorTween*) { return FRotator::ZeroRotator; }),
+			FNativeRotatorGetter::CreateLambda([](UQuickRotatorTween*) { return FRotator(90.0, 180.0, 0.0); }),
+			true,
+			FNativeRotatorSetter::CreateLambda([](const FRotator& value, UQuickRotatorTween*) { RotatorSink = value; }),
+			duration, 1.0f, easeType, nullptr, loops, loopType, tag, false);
+	}
+}
+
+static FQuickTweenBenchmarkResult RunBenchmark(UWorld* world, UQuickTweenManager* manager, int32 numTweens, int32 numFrames)
+{
+	FQuickTweenBenchmarkResult result;
+	result.NumTweens = numTweens;
+	result.NumFrames = numFrames;
+
+	FRandomStream random(BenchmarkSeed);
+	TArray<UQuickTweenBase*> tweens;
+	tweens.Reserve(numTweens);
+
+	const int64 usedPhysicalBefore = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical);
+	const double createStart = FPlatformTime::Seconds();
+	for (int32 index = 0; index < numTweens; ++index)
+	{
+		tweens.Add(CreateBenchmarkTween(world, index, random));
+	}
+	result.CreateMs = (FPlatformTime::Seconds() - createStart) * 1000.0;
+	result.UsedPhysicalBytes = static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - usedPhysicalBefore;
+
+	// ... mixed states: most play, some are paused after starting and the rest stay idle
+	for (UQuickTweenBase* tween : tweens)
+	{
+		const int32 stateRoll = random.RandHelper(20);
+		if (stateRoll < 17)
+		{
+			tween->Play();
+		}
+		if (stateRoll >= 14 && stateRoll < 17)
+		{
+			tween->Pause();
+		}
+		result.ObjectBytes += tween->GetClass()->GetStructureSize();
+	}
+	result.ContainerBytes = manager->GetAllocatedSize();
+
+	TArray<double> frameMs;
+	frameMs.Reserve(numFrames);
+	for (int32 frame = 0; frame < numFrames; ++frame)
+	{
+		const double tickStart = FPlatformTime::Seconds();
+		manager->Tick(BenchmarkDeltaTime);
+		frameMs.Add((FPlatformTime::Seconds() - tickStart) * 1000.0);
+	}
+
+	if (!frameMs.IsEmpty())
+	{
+		double totalMs = 0.0;
+		for (const double ms : frameMs)
+		{
+			totalMs += ms;
+		}
+		frameMs.Sort();
+		result.TickMeanMs = totalMs / frameMs.Num();
+		result.TickMedianMs = frameMs[frameMs.Num() / 2];
+		result.TickP95Ms = frameMs[FMath::Min(frameMs.Num() - 1, FMath::FloorToInt32(frameMs.Num() * 0.95))];
+		result.TickMaxMs = frameMs.Last();
+	}
+
+	// ... killed tweens are compacted at the start of the next tick
+	for (UQuickTweenBase* tween : tweens)
+	{
+		tween->Kill();
+	}
+	manager->Tick(0.0f);
+
+	for (const UQuickTweenBase* tween : tweens)
+	{
+		if (tween->GetTweenHandle().IsSet())
+		{
+			++result.NumNotReleased;
+		}
+	}
+
+	return result;
+}
+
+static FString ToJson(const TArray<FQuickTweenBenchmarkResult>& results)
+{
+	FString json = FString::Printf(TEXT("{\n\t\"timestamp\": \"%s\",\n\t\"deltaTime\": %f,\n\t\"results\": ["), *FDateTime::UtcNow().ToIso8601(), BenchmarkDeltaTime);
+	for (int32 index = 0; index < results.Num(); ++index)
+	{
+		const FQuickTweenBenchmarkResult& result = results[index];
+		json += FString::Printf(
+			TEXT("%s\n\t\t{ \"tweens\": %d, \"frames\": %d, \"createMs\": %.4f, \"tickMeanMs\": %.4f, \"tickMedianMs\": %.4f, \"tickP95Ms\": %.4f, \"tickMaxMs\": %.4f, \"objectBytes\": %llu, \"containerBytes\": %llu, \"usedPhysicalBytes\": %lld }"),
+			index > 0 ? TEXT(",") : TEXT(""),
+			result.NumTweens,
+			result.NumFrames,
+			result.CreateMs,
+			result.TickMeanMs,
+			result.TickMedianMs,
+			result.TickP95Ms,
+			result.TickMaxMs,
+			static_cast<uint64>(result.ObjectBytes),
+			static_cast<uint64>(result.ContainerBytes),
+			result.UsedPhysicalBytes);
+	}
+	json += TEXT("\n\t]\n}\n");
+	return json;
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FQuickTweenBenchmarkTest, "QuickTween.Benchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext |
+	EAutomationTestFlags::CommandletContext | EAutomationTestFlags::PerfFilter)
+
+void FQuickTweenBenchmarkTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const int32 count : BenchmarkCounts)
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%d tweens"), count));
+		OutTestCommands.Add(FString::FromInt(count));
+	}
+}
+
+// Create float, vector and rotator tweens with mixed states, loops and eases in a world of its own, tick the manager
+// and report creation time, tick time and memory as JSON. Runs headless, e.g.
+// -nullrhi -unattended -ExecCmds="Automation RunTests QuickTween.Benchmark; Quit"
+bool FQuickTweenBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const int32 numTweens = FMath::Max(1, FCString::Atoi(*Parameters));
+
+	UWorld* world = UWorld::CreateWorld(EWorldType::Game, false, TEXT("QuickTweenBenchmark"));
+	FWorldContext& worldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	worldContext.SetCurrentWorld(world);
+	world->InitializeActorsForPlay(FURL());
+	world->BeginPlay();
+
+	UQuickTweenManager* manager = UQuickTweenManager::Get(world);
+	if (TestNotNull(TEXT("Tween manager of the benchmark world"), manager))
+	{
+		TArray<FQuickTweenBenchmarkResult> results;
+		const FQuickTweenBenchmarkResult& result = results.Add_GetRef(RunBenchmark(world, manager, numTweens, BenchmarkFrames));
+		AddInfo(FString::Printf(TEXT("%7d tweens: create %.2f ms, tick mean %.3f ms, median %.3f ms, p95 %.3f ms, max %.3f ms, %.1f KB"),
+			result.NumTweens, result.CreateMs, result.TickMeanMs, result.TickMedianMs, result.TickP95Ms, result.TickMaxMs,
+			(result.ObjectBytes + result.ContainerBytes) / 1024.0));
+
+		// ... every tween was killed by the run, the closing tick must have compacted all of them
+		TestEqual(TEXT("Registered tweens after the run"), manager->FindAllTweensByPredicate([](UQuickTweenable*) { return true; }).Num(), 0);
+		TestEqual(TEXT("Tweens still holding a handle after the run"), result.NumNotReleased, 0);
+
+		const FString json = ToJson(results);
+		UE_LOG(LogQuickTweenBenchmark, Display, TEXT("%s"), *json);
+		const FString fileName = FPaths::Combine(FPaths::ProfilingDir(), TEXT("QuickTween"),
+			FString::Printf(TEXT("Benchmark-%d-%s.json"), numTweens, *FDateTime::Now().ToString()));
+		if (!FFileHelper::SaveStringToFile(json, *fileName))
+		{
+			AddWarning(FString::Printf(TEXT("Failed to write %s"), *fileName));
+		}
+	}
+
+	GEngine->DestroyWorldContext(world);
+	world->DestroyWorld(false);
+	return true;
+}
+
+#endif
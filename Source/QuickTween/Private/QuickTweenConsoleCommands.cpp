@@ -0,0 +1,260 @@
+﻿// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "QuickTweenManager.h"
+#include "QuickTweenable.h"
+#include "Tweens/QuickTweenBase.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+// Number of entries printed per category by QuickTween.Stats
+static constexpr int32 MaxStatsEntries = 10;
+
+// Invoke func with the tween manager of every game world
+static void ForEachManager(TFunctionRef<void(UWorld*, UQuickTweenManager*)> func)
+{
+	if (!GEngine)
+	{
+		return;
+	}
+
+	for (const FWorldContext& context : GEngine->GetWorldContexts())
+	{
+		UWorld* world = context.World();
+		if (!world || !world->IsGameWorld())
+		{
+			continue;
+		}
+
+		if (UQuickTweenManager* manager = world->GetSubsystem<UQuickTweenManager>())
+		{
+			func(world, manager);
+		}
+	}
+}
+
+static FString GetStateName(const UQuickTweenable* tween)
+{
+	if (const UQuickTweenBase* baseTween = Cast<UQuickTweenBase>(tween))
+	{
+		return StaticEnum<EQuickTweenState>()->GetNameStringByValue(static_cast<int64>(baseTween->GetTweenState()));
+	}
+
+	if (tween->GetIsPendingKill())
+	{
+		return TEXT("Kill");
+	}
+	if (tween->GetIsCompleted())
+	{
+		return TEXT("Complete");
+	}
+	if (tween->GetIsPlaying())
+	{
+		return TEXT("Play");
+	}
+	// ... the generic interface doesn't tell a paused tween from an idle one, one that never advanced is idle
+	return tween->GetElapsedTime() > 0.0f ? TEXT("Pause") : TEXT("Idle");
+}
+
+static FString GetTagName(const UQuickTweenable* tween)
+{
+	const FName tag = tween->GetTweenTagName();
+	return tag.IsNone() ? TEXT("-") : tag.ToString();
+}
+
+// Gather the registered tweens of a manager, tagged at or below tagFilter unless it is none
+static TArray<UQuickTweenable*> GatherTweens(const UQuickTweenManager* manager, FName tagFilter)
+{
+	if (!tagFilter.IsNone())
+	{
+		TArray<UQuickTweenable*> tweens;
+		manager->FindAllTweensByTag(tagFilter, tweens, true);
+		return tweens;
+	}
+	return manager->FindAllTweensByPredicate([](UQuickTweenable*) { return true; });
+}
+
+static void BuildTweenList(FName tagFilter, TArray<FString>& outLines)
+{
+	outLines.Add(FString::Printf(TEXT("%-32s %-10s %-32s %10s %10s  %s"), TEXT("Class"), TEXT("State"), TEXT("Tag"), TEXT("Elapsed"), TEXT("Duration"), TEXT("World")));
+
+	int32 numTweens = 0;
+	ForEachManager([tagFilter, &outLines, &numTweens](UWorld* world, UQuickTweenManager* manager)
+	{
+		for (const UQuickTweenable* tween : GatherTweens(manager, tagFilter))
+		{
+			outLines.Add(FString::Printf(TEXT("%-32s %-10s %-32s %10.2f %10.2f  %s"),
+				*tween->GetClass()->GetName(),
+				*GetStateName(tween),
+				*GetTagName(tween),
+				tween->GetElapsedTime(),
+				tween->GetTotalDuration(),
+				*world->GetName()));
+			++numTweens;
+		}
+	});
+
+	outLines.Add(FString::Printf(TEXT("%d tweens"), numTweens));
+}
+
+static FString FormatStatsValue(int32 value)
+{
+	return FString::FromInt(value);
+}
+
+static FString FormatStatsValue(float value)
+{
+	return FString::Printf(TEXT("%.2f"), value);
+}
+
+// Append the entries of a category, largest first
+template <typename ValueType>
+static void AppendTopEntries(const TCHAR* title, TMap<FString, ValueType>& entries, TArray<FString>& outLines)
+{
+	entries.ValueSort([](ValueType a, ValueType b) { return a > b; });
+
+	outLines.Add(FString::Printf(TEXT("%s:"), title));
+	int32 numPrinted = 0;
+	for (const TPair<FString, ValueType>& pair : entries)
+	{
+		if (numPrinted++ == MaxStatsEntries)
+		{
+			outLines.Add(FString::Printf(TEXT("  ... %d more"), entries.Num() - MaxStatsEntries));
+			break;
+		}
+		outLines.Add(FString::Printf(TEXT("  %-32s %s"), *pair.Key, *FormatStatsValue(pair.Value)));
+	}
+}
+
+static void BuildTweenStats(TArray<FString>& outLines)
+{
+	TMap<FString, int32> byClass;
+	TMap<FString, int32> byState;
+	TMap<FString, int32> byTag;
+	TMap<FString, int32> byWorld;
+	TMap<FString, float> timeByTag;
+	int32 numTweens = 0;
+	SIZE_T containerBytes = 0;
+	SIZE_T objectBytes = 0;
+
+	ForEachManager([&](UWorld* world, UQuickTweenManager* manager)
+	{
+		containerBytes += manager->GetAllocatedSize();
+
+		const TArray<UQuickTweenable*> tweens = GatherTweens(manager, NAME_None);
+		byWorld.Add(world->GetName(), tweens.Num());
+		for (const UQuickTweenable* tween : tweens)
+		{
+			const FString tag = GetTagName(tween);
+			++byClass.FindOrAdd(tween->GetClass()->GetName());
+			++byState.FindOrAdd(GetStateName(tween));
+			++byTag.FindOrAdd(tag);
+			timeByTag.FindOrAdd(tag) += tween->GetElapsedTime();
+			objectBytes += tween->GetClass()->GetStructureSize();
+		}
+		numTweens += tweens.Num();
+	});
+
+	outLines.Add(FString::Printf(TEXT("%d tweens, approximately %.1f KB (%.1f KB objects, %.1f KB manager containers)"),
+		numTweens, (objectBytes + containerBytes) / 1024.0, objectBytes / 1024.0, containerBytes / 1024.0));
+	AppendTopEntries(TEXT("By class"), byClass, outLines);
+	AppendTopEntries(TEXT("By state"), byState, outLines);
+	AppendTopEntries(TEXT("By tag"), byTag, outLines);
+	AppendTopEntries(TEXT("By world"), byWorld, outLines);
+	AppendTopEntries(TEXT("Top tags by time played (s)"), timeByTag, outLines);
+}
+
+static void LogLines(const TArray<FString>& lines, FOutputDevice& ar)
+{
+	for (const FString& line : lines)
+	{
+		ar.Log(line);
+	}
+}
+
+static void ListTweens(const TArray<FString>& args, UWorld* world, FOutputDevice& ar)
+{
+	TArray<FString> lines;
+	BuildTweenList(args.IsEmpty() ? NAME_None : FName(*args[0]), lines);
+	LogLines(lines, ar);
+}
+
+static void PrintTweenStats(const TArray<FString>& args, UWorld* world, FOutputDevice& ar)
+{
+	TArray<FString> lines;
+	BuildTweenStats(lines);
+	LogLines(lines, ar);
+}
+
+static void KillTweensByTag(const TArray<FString>& args, UWorld* world, FOutputDevice& ar)
+{
+	if (args.IsEmpty())
+	{
+		ar.Log(TEXT("Usage: QuickTween.KillByTag <tag>"));
+		return;
+	}
+
+	const FName tag(*args[0]);
+	int32 numKilled = 0;
+	ForEachManager([tag, &numKilled](UWorld*, UQuickTweenManager* manager)
+	{
+		manager->ExecuteActionByTag(tag, [&numKilled](UQuickTweenable* tween)
+		{
+			tween->Kill();
+			++numKilled;
+		}, true);
+	});
+
+	ar.Logf(TEXT("Killed %d tweens tagged %s"), numKilled, *tag.ToString());
+}
+
+static void DumpTweens(const TArray<FString>& args, UWorld* world, FOutputDevice& ar)
+{
+	FString fileName = args.IsEmpty() ? TEXT("QuickTweenDump.txt") : args[0];
+	if (FPaths::IsRelative(fileName))
+	{
+		fileName = FPaths::Combine(FPaths::ProfilingDir(), TEXT("QuickTween"), fileName);
+	}
+
+	TArray<FString> lines;
+	BuildTweenStats(lines);
+	lines.Add(FString());
+	BuildTweenList(NAME_None, lines);
+
+	if (FFileHelper::SaveStringArrayToFile(lines, *fileName))
+	{
+		ar.Logf(TEXT("Dumped the tweens to %s"), *FPaths::ConvertRelativePathToFull(fileName));
+	}
+	else
+	{
+		ar.Logf(TEXT("Failed to write %s"), *fileName);
+	}
+}
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice QuickTweenListCommand(
+	TEXT("QuickTween.List"),
+	TEXT("List the registered tweens of every game world with class, state, tag and time. Usage: QuickTween.List [tag], child tags match."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&ListTweens));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice QuickTweenStatsCommand(
+	TEXT("QuickTween.Stats"),
+	TEXT("Print tween counts by class, state, tag and world, the tags with the most time played and the approximate memory."),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&PrintTweenStats));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice QuickTweenKillByTagCommand(
+	TEXT("QuickTween.KillByTag"),
+	TEXT("Kill every tween tagged at or below the tag in every game world. Usage: QuickTween.KillByTag <tag>"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&KillTweensByTag));
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice QuickTweenDumpCommand(
+	TEXT("QuickTween.Dump"),
+	TEXT("Write QuickTween.Stats and QuickTween.List to a file, relative paths go to Saved/Profiling/QuickTween. Usage: QuickTween.Dump [file]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&DumpTweens));
+
+#endif
@@ -0,0 +1,86 @@
+﻿// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+
+
+#include "QuickTweenGroup.h"
+#include "QuickTweenManager.h"
+#include "QuickTweenable.h"
+#include "Tweens/QuickTweenBase.h"
+
+void UQuickTweenGroup::Add(UQuickTweenable* tween)
+{
+	if (UQuickTweenManager* manager = Manager.Get())
+	{
+		manager->AddToGroup(this, tween);
+	}
+}
+
+void UQuickTweenGroup::Remove(UQuickTweenable* tween)
+{
+	UQuickTweenManager* manager = Manager.Get();
+	if (manager && tween && tween->GetTweenGroup() == this)
+	{
+		manager->RemoveFromGroup(tween);
+	}
+}
+
+void UQuickTweenGroup::Play()
+{
+	ForEachMember([](UQuickTweenable* tween) { tween->Play(); });
+}
+
+void UQuickTweenGroup::Pause()
+{
+	ForEachMember([](UQuickTweenable* tween) { tween->Pause(); });
+}
+
+void UQuickTweenGroup::Reverse()
+{
+	ForEachMember([](UQuickTweenable* tween) { tween->Reverse(); });
+}
+
+void UQuickTweenGroup::Restart()
+{
+	ForEachMember([](UQuickTweenable* tween) { tween->Restart(); });
+}
+
+void UQuickTweenGroup::Complete(bool bSnapToEnd)
+{
+	ForEachMember([bSnapToEnd](UQuickTweenable* tween) { tween->Complete(bSnapToEnd); });
+}
+
+void UQuickTweenGroup::Kill()
+{
+	ForEachMember([](UQuickTweenable* tween) { tween->Kill(); });
+}
+
+void UQuickTweenGroup::SetTimeScale(float timeScale)
+{
+	ForEachMember([timeScale](UQuickTweenable* tween)
+	{
+		if (UQuickTweenBase* baseTween = Cast<UQuickTweenBase>(tween))
+		{
+			baseTween->SetTimeScale(timeScale);
+		}
+	});
+}
+
+TArray<UQuickTweenable*> UQuickTweenGroup::GetTweens() const
+{
+	TArray<UQuickTweenable*> tweens;
+	tweens.Reserve(Members.Num());
+	ForEachMember([&tweens](UQuickTweenable* tween) { tweens.Add(tween); });
+	return tweens;
+}
+
+void UQuickTweenGroup::ForEachMember(TFunctionRef<void(UQuickTweenable*)> func) const
+{
+	// ... snapshot, callbacks may add, remove or kill members
+	const TArray<UQuickTweenable*> members = Members;
+	for (UQuickTweenable* tween : members)
+	{
+		if (tween && !tween->GetIsPendingKill())
+		{
+			func(tween);
+		}
+	}
+}
@@ -0,0 +1,97 @@
+﻿// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+
+#include "QuickTweenHandle.h"
+#include "QuickTweenable.h"
+
+TArray<FQuickTweenHandleRegistry::FSlot> FQuickTweenHandleRegistry::Slots;
+TArray<int32> FQuickTweenHandleRegistry::FreeSlots;
+uint32 FQuickTweenHandleRegistry::LastGeneration = 0;
+
+FQuickTweenHandle FQuickTweenHandleRegistry::Issue(UQuickTweenable* tween)
+{
+	check(IsInGameThread());
+
+	// ... 0 marks an unset handle
+	if (++LastGeneration == 0)
+	{
+		++LastGeneration;
+	}
+
+	FQuickTweenHandle handle;
+	handle.Index = FreeSlots.IsEmpty() ? Slots.AddDefaulted() : FreeSlots.Pop(EAllowShrinking::No);
+	handle.Generation = LastGeneration;
+
+	FSlot& slot = Slots[handle.Index];
+	slot.Tween = tween;
+	slot.Generation = handle.Generation;
+	return handle;
+}
+
+void FQuickTweenHandleRegistry::Release(const FQuickTweenHandle& handle)
+{
+	check(IsInGameThread());
+
+	// ... match on the generation only, the tween may have been garbage collected already
+	if (!handle.IsSet() || !Slots.IsValidIndex(handle.Index) || Slots[handle.Index].Generation != handle.Generation)
+	{
+		return;
+	}
+
+	FSlot& slot = Slots[handle.Index];
+	slot.Tween.Reset();
+	slot.Generation = 0;
+	FreeSlots.Add(handle.Index);
+}
+
+UQuickTweenable* FQuickTweenHandleRegistry::Resolve(const FQuickTweenHandle& handle)
+{
+	if (!handle.IsSet() || !Slots.IsValidIndex(handle.Index))
+	{
+		return nullptr;
+	}
+
+	const FSlot& slot = Slots[handle.Index];
+	return slot.Generation == handle.Generation ? slot.Tween.Get() : nullptr;
+}
+
+void FQuickTweenHandle::Play() const
+{
+	if (UQuickTweenable* tween = Get())
+	{
+		tween->Play();
+	}
+}
+
+void FQuickTweenHandle::Pause() const
+{
+	if (UQuickTweenable* tween = Get())
+	{
+		tween->Pause();
+	}
+}
+
+void FQuickTweenHandle::Kill() const
+{
+	if (UQuickTweenable* tween = Get())
+	{
+		tween->Kill();
+	}
+}
+
+bool FQuickTweenHandle::IsAlive() const
+{
+	return Get() != nullptr;
+}
+
+float FQuickTweenHandle::GetElapsedTime() const
+{
+	const UQuickTweenable* tween = Get();
+	return tween ? tween->GetElapsedTime() : 0.0f;
+}
+
+UQuickTweenable* FQuickTweenHandle::Get() const
+{
+	// ... killed tweens stay registered until the next compaction, treat them as gone already
+	UQuickTweenable* tween = FQuickTweenHandleRegistry::Resolve(*this);
+	return tween && !tween->GetIsPendingKill() ? tween : nullptr;
+}
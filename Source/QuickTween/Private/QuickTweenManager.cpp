@@ -2,13 +2,112 @@
 
 #include "QuickTweenManager.h"
 #include "QuickTweenable.h"
+#include "QuickTweenGroup.h"
+#include "QuickTweenStats.h"
+#include "QuickTweenTrace.h"
+#include "Tweens/QuickTweenBase.h"
+#include "Tweens/QuickTweenSequence.h"
 #include "Algo/AllOf.h"
 #include "Algo/Find.h"
 #include "Algo/FindLast.h"
+#include "Async/ParallelFor.h"
+#include "Tasks/Task.h"
 #include "Engine/World.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+#include "UObject/UObjectGlobals.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogQuickTweenManager, Log, All);
 
+static TAutoConsoleVariable<bool> CVarQuickTweenForceSerialCompute(
+	TEXT("QuickTween.ForceSerialCompute"),
+	false,
+	TEXT("If true, the tween compute phase runs on the game thread instead of worker threads."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarQuickTweenFrameBudgetMs(
+	TEXT("QuickTween.FrameBudgetMs"),
+	0.0f,
+	TEXT("Milliseconds per frame the manager may spend updating tweens. Critical tweens always update, the rest are deferred round-robin once the budget is spent. 0 disables the budget."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarQuickTweenLODBaseDistance(
+	TEXT("QuickTween.LOD.BaseDistance"),
+	0.0f,
+	TEXT("Distance (cm) from the nearest player view beyond which tweens with a significance source update every 2nd frame, every 4th beyond twice it and every 8th beyond four times it. 0 disables the reduced rates."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarQuickTweenFixedStep(
+	TEXT("QuickTween.FixedStep"),
+	0.0f,
+	TEXT("Fixed timestep (seconds) tweens advance by, e.g. 0.0166667 for 60 Hz. 0 advances by the frame delta."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarQuickTweenFixedStepMaxSubsteps(
+	TEXT("QuickTween.FixedStepMaxSubsteps"),
+	4,
+	TEXT("Maximum fixed steps advanced in a single frame. Time beyond that is dropped so catching up after a hitch stays bounded."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarQuickTweenFixedStepInterpolate(
+	TEXT("QuickTween.FixedStepInterpolate"),
+	false,
+	TEXT("If true, fixed step tweens render their value between the last two steps, one step behind the simulation."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<bool> CVarQuickTweenPool(
+	TEXT("QuickTween.Pool"),
+	false,
+	TEXT("If true, tween factories recycle killed tweens from a per-class pool instead of creating new objects."),
+	ECVF_Default);
+
+// Minimum number of tweens handed to a single worker in the compute phase
+static constexpr int32 ComputeMinBatchSize = 256;
+
+// ManagerSlot of a tween queued by AddTween during Tick
+static constexpr int32 PendingSlot = -2;
+
+// Invoke func with the tag and each of its dot-separated parents ("A.B.C", "A.B", "A")
+static void ForEachTagLevel(FName tag, TFunctionRef<void(FName)> func)
+{
+	func(tag);
+
+	FString tagString = tag.ToString();
+	int32 dotIndex = INDEX_NONE;
+	while (tagString.FindLastChar(TEXT('.'), dotIndex))
+	{
+		tagString.LeftInline(dotIndex);
+		func(FName(*tagString));
+	}
+}
+
+// Outermost sequence owning the tween, the tween itself when it has no owner
+static UQuickTweenable* GetRootOwner(UQuickTweenable* tween)
+{
+	while (UQuickTweenable* owner = tween->GetOwner())
+	{
+		tween = owner;
+	}
+	return tween;
+}
+
+// Whether a tween or sequence is playing or paused, the states conflicts are resolved against
+static bool IsRunning(const UQuickTweenable* tween)
+{
+	EQuickTweenState state = EQuickTweenState::Idle;
+	if (const UQuickTweenBase* baseTween = Cast<UQuickTweenBase>(tween))
+	{
+		state = baseTween->GetTweenState();
+	}
+	else if (const UQuickTweenSequence* sequence = Cast<UQuickTweenSequence>(tween))
+	{
+		state = sequence->GetTweenState();
+	}
+	return state == EQuickTweenState::Play || state == EQuickTweenState::Pause;
+}
+
 UQuickTweenManager* UQuickTweenManager::Get(const UObject* worldContextObject)
 {
 	if (IsValid(worldContextObject))
@@ -22,6 +121,43 @@ UQuickTweenManager* UQuickTweenManager::Get(const UObject* worldContextObject)
 	return nullptr;
 }
 
+UQuickTweenable* UQuickTweenManager::NewTween(UClass* tweenClass, UObject* worldContextObject)
+{
+	if (CVarQuickTweenPool.GetValueOnGameThread())
+	{
+		if (UQuickTweenManager* manager = Get(worldContextObject))
+		{
+			return manager->TweenPool.Acquire(tweenClass, manager);
+		}
+	}
+	return NewObject<UQuickTweenable>(worldContextObject, tweenClass);
+}
+
+FQuickTweenTransformBatch& UQuickTweenManager::GetTransformBatch(const UObject* worldContextObject)
+{
+	if (UQuickTweenManager* manager = Get(worldContextObject))
+	{
+		return manager->TransformBatch;
+	}
+	return GetPassThroughBatch();
+}
+
+FQuickTweenTransformBatch& UQuickTweenManager::GetTransformBatch(const UQuickTweenBase* tween)
+{
+	if (UQuickTweenManager* manager = tween ? tween->Manager.Get() : nullptr)
+	{
+		return manager->TransformBatch;
+	}
+	return GetPassThroughBatch();
+}
+
+FQuickTweenTransformBatch& UQuickTweenManager::GetPassThroughBatch()
+{
+	// ... never begun, so every write goes straight to the component
+	static FQuickTweenTransformBatch PassThroughBatch;
+	return PassThroughBatch;
+}
+
 UWorld* UQuickTweenManager::GetTickableGameObjectWorld() const
 {
 	return GetWorld();
@@ -32,6 +168,8 @@ void UQuickTweenManager::Initialize(FSubsystemCollectionBase& Collection)
 	check(!bIsInitialized);
 	bIsInitialized = true;
 
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UQuickTweenManager::HandlePostGarbageCollect);
+
 	// Refresh the tick type after initialization
 	SetTickableTickType(GetTickableTickType());
 }
@@ -41,6 +179,60 @@ void UQuickTweenManager::Deinitialize()
 	check(bIsInitialized);
 	bIsInitialized = false;
 
+	// ... the task reads the pipeline arrays, they must outlive it
+	if (PipelineTask.IsValid())
+	{
+		PipelineTask.Wait();
+		PipelineTask = UE::Tasks::FTask();
+	}
+	PipelineTweens.Reset();
+
+	// ... outstanding handles go stale with the manager
+	ForEachTween([this](UQuickTweenable* tween)
+	{
+		UntrackTween(tween);
+		return true;
+	});
+
+	// ... hand the hot state back to the tweens, they may outlive this manager
+	TweenStorage.Reset();
+	TweensByTag.Reset();
+	TweensByTarget.Reset();
+	SequenceTweensByTarget.Reset();
+	SweptTargets.Reset();
+	for (const TWeakObjectPtr<AActor>& actor : WatchedActors)
+	{
+		if (actor.IsValid())
+		{
+			actor->OnEndPlay.RemoveDynamic(this, &UQuickTweenManager::HandleTargetActorEndPlay);
+		}
+	}
+	WatchedActors.Reset();
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	TweenPool.Reset();
+	NativeTweens.Reset();
+	for (UQuickTweenable* tween : PendingAdds)
+	{
+		tween->ManagerSlot = INDEX_NONE;
+	}
+	PendingAdds.Reset();
+	Commands.Empty();
+
+	for (FQuickTweenManagerTickFunction& tickFunction : GroupTickFunctions)
+	{
+		if (tickFunction.IsTickFunctionRegistered())
+		{
+			tickFunction.UnRegisterTickFunction();
+		}
+		tickFunction.Manager = nullptr;
+	}
+	PendingTickGroupMask = 0;
+	if (PipelineSyncTickFunction.IsTickFunctionRegistered())
+	{
+		PipelineSyncTickFunction.UnRegisterTickFunction();
+	}
+	PipelineSyncTickFunction.Manager = nullptr;
+
 	// Always cancel tick as this is about to be destroyed
 	SetTickableTickType(ETickableTickType::Never);
 }
@@ -51,81 +243,1297 @@ void UQuickTweenManager::Tick(float deltaTime)
 	{
 		return;
 	}
+	QUICKTWEEN_TRACE_SCOPE(QuickTween_Tick);
+
+	const bool bIsWorldPaused = GetWorld()->IsPaused();
+
+	// ... a pipelined pass whose sync didn't run must not outlive the compaction of its tweens
+	SyncPipeline();
+
+	// ... groups used before the world had a level to register their tick function in
+	for (int32 group = 0; PendingTickGroupMask != 0 && group < static_cast<int32>(EQuickTweenTickGroup::Num); ++group)
+	{
+		if (PendingTickGroupMask & (1u << group))
+		{
+			EnsureTickFunction(static_cast<EQuickTweenTickGroup>(group));
+		}
+	}
+
+	// ... before compaction so tweens killed by a command are released this frame
+	ExecuteCommands();
+	CompactTweens();
+
+	// ... from here on slots must stay stable, adds are queued and removals leave holes
+	bIsTicking = true;
+	TransformBatch.Begin();
+
+	const int32 numFixedSteps = ConsumeFixedSteps(deltaTime, EQuickTweenTickGroup::Default);
+	UpdateStorageGroup(deltaTime, numFixedSteps, bIsWorldPaused, EQuickTweenTickGroup::Default);
+
+	// ... native tweens and sequences step like the storage so fixed step results don't depend on the frame rate
+	const bool bIsFixedStep = TweenStorage.FixedStep > 0.0f;
+	const int32 numUpdates = bIsFixedStep ? numFixedSteps : 1;
+	const float updateDelta = bIsFixedStep ? TweenStorage.FixedStep : deltaTime;
+
+	for (int32 update = 0; update < numUpdates; ++update)
+	{
+		NativeTweens.Tick(updateDelta, bIsWorldPaused, CVarQuickTweenForceSerialCompute.GetValueOnGameThread(), ComputeMinBatchSize);
+	}
 
 	for (int i = QuickTweens.Num() - 1; i >= 0; --i)
 	{
+		// ... holes are left by removals during this pass, dead tweens wait for the next compaction
 		UQuickTweenable* tweenContainer = QuickTweens[i];
-		if (!tweenContainer)
+		if (!tweenContainer || tweenContainer->GetIsPendingKill())
 		{
-			UE_LOG(LogQuickTweenManager, Warning, TEXT("Null tween found in QuickTweenManager, removing it."));
-			QuickTweens.RemoveAt(i);
 			continue;
 		}
 
-		if (tweenContainer->GetIsPendingKill())
+		if (bIsWorldPaused && !tweenContainer->GetShouldPlayWhilePaused())
 		{
-			QuickTweens.RemoveAt(i);
 			continue;
 		}
 
-		if (GetWorld()->IsPaused() && !tweenContainer->GetShouldPlayWhilePaused())
+		for (int32 update = 0; update < numUpdates && tweenContainer->GetIsPlaying(); ++update)
 		{
-			continue;
+			tweenContainer->Update(updateDelta);
+		}
+
+	}
+
+	TransformBatch.Flush();
+	bIsTicking = false;
+	FlushPendingAdds();
+
+#if STATS
+	int32 numPlaying = 0;
+	int32 numPaused = 0;
+	int32 numIdle = 0;
+	for (int32 group = 0; group < static_cast<int32>(EQuickTweenTickGroup::Num); ++group)
+	{
+		const EQuickTweenTickGroup tickGroup = static_cast<EQuickTweenTickGroup>(group);
+		numPlaying += TweenStorage.NumInBucket(EQuickTweenBucket::Playing, tickGroup) + TweenStorage.NumInBucket(EQuickTweenBucket::PlayingWhilePaused, tickGroup);
+		numPaused += TweenStorage.NumInBucket(EQuickTweenBucket::Paused, tickGroup);
+		numIdle += TweenStorage.NumInBucket(EQuickTweenBucket::Idle, tickGroup);
+	}
+	SET_DWORD_STAT(STAT_QuickTween_NumActive, TweenStorage.Num() + QuickTweens.Num() + NativeTweens.Num());
+	SET_DWORD_STAT(STAT_QuickTween_NumPlaying, numPlaying);
+	SET_DWORD_STAT(STAT_QuickTween_NumPaused, numPaused);
+	SET_DWORD_STAT(STAT_QuickTween_NumIdle, numIdle);
+#endif
+}
+
+void UQuickTweenManager::TickGroup(float deltaTime, EQuickTweenTickGroup group)
+{
+	if (!bIsInitialized)
+	{
+		return;
+	}
+	QUICKTWEEN_TRACE_SCOPE(QuickTween_TickGroup);
+
+	if (group == EQuickTweenTickGroup::Pipelined)
+	{
+		LaunchPipeline(deltaTime, ConsumeFixedSteps(deltaTime, group), GetWorld()->IsPaused());
+		return;
+	}
+
+	bIsTicking = true;
+	TransformBatch.Begin();
+	UpdateStorageGroup(deltaTime, ConsumeFixedSteps(deltaTime, group), GetWorld()->IsPaused(), group);
+	TransformBatch.Flush();
+	bIsTicking = false;
+	FlushPendingAdds();
+}
+
+void UQuickTweenManager::LaunchPipeline(float deltaTime, int32 numFixedSteps, bool bIsWorldPaused)
+{
+	// ... the sync of the previous pass didn't run, apply it before its arrays are reused
+	SyncPipeline();
+
+	const bool bInterpolate = TweenStorage.FixedStep > 0.0f && CVarQuickTweenFixedStepInterpolate.GetValueOnGameThread();
+	if (TweenStorage.FixedStep > 0.0f && numFixedSteps == 0 && !bInterpolate)
+	{
+		return;
+	}
+	TweenStorage.RenderLag = bInterpolate ? TweenStorage.FixedStep - static_cast<float>(FixedStepAccumulators[static_cast<int32>(EQuickTweenTickGroup::Pipelined)]) : 0.0f;
+
+	// ... opting in means accepting the latency, the frame budget doesn't defer these
+	FQuickTweenAdvanceBudget budget;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_QuickTween_Advance);
+		TweenStorage.Advance(deltaTime, numFixedSteps, GFrameCounter, bIsWorldPaused, EQuickTweenTickGroup::Pipelined, budget, PipelineTweens, PipelineSlots);
+	}
+
+	// ... the task works on a copy, the storage may grow or shrink until the sync
+	PipelineInputs.SetNum(PipelineSlots.Num());
+	for (int32 index = 0; index < PipelineSlots.Num(); ++index)
+	{
+		TweenStorage.GatherComputeInput(PipelineSlots[index], PipelineInputs[index]);
+	}
+	TweenStorage.RenderLag = 0.0f;
+
+	if (PipelineInputs.IsEmpty())
+	{
+		return;
+	}
+
+	PipelineStates.Reset();
+	PipelineStates.SetNum(PipelineInputs.Num());
+	const EParallelForFlags flags = CVarQuickTweenForceSerialCompute.GetValueOnGameThread() ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+	PipelineTask = UE::Tasks::Launch(TEXT("QuickTween.PipelineCompute"), [this, flags]()
+	{
+		SCOPE_CYCLE_COUNTER(STAT_QuickTween_Ease);
+		ParallelFor(
+			TEXT("QuickTween.PipelineCompute"),
+			PipelineInputs.Num(),
+			ComputeMinBatchSize,
+			[this](int32 index)
+			{
+				if (PipelineInputs[index].bShouldCompute)
+				{
+					FQuickTweenStorage::Compute(PipelineInputs[index], PipelineStates[index]);
+				}
+			},
+			flags);
+	});
+}
+
+void UQuickTweenManager::SyncPipeline()
+{
+	if (!PipelineTask.IsValid())
+	{
+		return;
+	}
+	QUICKTWEEN_TRACE_SCOPE(QuickTween_SyncPipeline);
+
+	PipelineTask.Wait();
+	PipelineTask = UE::Tasks::FTask();
+
+	bIsTicking = true;
+	TransformBatch.Begin();
+	for (int32 index = 0; index < PipelineTweens.Num(); ++index)
+	{
+		// ... control calls made since the launch win, uncomputed or outdated results are recomputed on the spot
+		UQuickTweenBase* tween = PipelineTweens[index];
+		if (tween->IsInStorage() && tween->GetIsPlaying())
+		{
+			if (const USceneComponent* source = tween->GetSignificanceSource())
+			{
+				TweenStorage.UpdateInterval[tween->StorageSlot] = static_cast<uint8>(ComputeUpdateInterval(source));
+			}
+			tween->UpdateFromComputedState(PipelineStates[index]);
 		}
+	}
+	TransformBatch.Flush();
+	bIsTicking = false;
+
+	PipelineTweens.Reset();
+	PipelineSlots.Reset();
+	PipelineInputs.Reset();
+	FlushPendingAdds();
+}
+
+int32 UQuickTweenManager::ConsumeFixedSteps(float deltaTime, EQuickTweenTickGroup group)
+{
+	TweenStorage.FixedStep = FMath::Max(0.0f, CVarQuickTweenFixedStep.GetValueOnGameThread());
+
+	double& accumulator = FixedStepAccumulators[static_cast<int32>(group)];
+	if (TweenStorage.FixedStep <= 0.0f)
+	{
+		accumulator = 0.0;
+		return 0;
+	}
+
+	accumulator += deltaTime;
+	const int32 numSteps = FMath::FloorToInt32(accumulator / TweenStorage.FixedStep);
+	accumulator -= numSteps * static_cast<double>(TweenStorage.FixedStep);
+
+	// ... after a hitch the time beyond the cap is dropped, tweens fall behind instead of spiralling
+	return FMath::Min(numSteps, FMath::Max(1, CVarQuickTweenFixedStepMaxSubsteps.GetValueOnGameThread()));
+}
+
+void UQuickTweenManager::UpdateStorageGroup(float deltaTime, int32 numFixedSteps, bool bIsWorldPaused, EQuickTweenTickGroup group)
+{
+	check(bIsTicking);
+
+	const double startTime = FPlatformTime::Seconds();
+	if (BudgetFrame != GFrameCounter)
+	{
+		BudgetFrame = GFrameCounter;
+		BudgetStats = FQuickTweenBudgetStats();
+		BudgetStats.BudgetMs = FMath::Max(0.0f, CVarQuickTweenFrameBudgetMs.GetValueOnGameThread());
+	}
+
+	// ... without interpolation nothing changes until a whole step was accumulated
+	const bool bInterpolate = TweenStorage.FixedStep > 0.0f && CVarQuickTweenFixedStepInterpolate.GetValueOnGameThread();
+	if (TweenStorage.FixedStep > 0.0f && numFixedSteps == 0 && !bInterpolate)
+	{
+		return;
+	}
+	TweenStorage.RenderLag = bInterpolate ? TweenStorage.FixedStep - static_cast<float>(FixedStepAccumulators[static_cast<int32>(group)]) : 0.0f;
+
+	// ... the budget is turned into a tween count from the measured cost, no estimate yet means no limit
+	FQuickTweenAdvanceBudget budget;
+	if (BudgetStats.BudgetMs > 0.0f && AverageTweenCostMs > 0.0f)
+	{
+		const float remainingMs = FMath::Max(0.0f, BudgetStats.BudgetMs - BudgetStats.SpentMs);
+		budget.MaxAdvanced = FMath::FloorToInt32(remainingMs / AverageTweenCostMs);
+	}
+
+	// ... advance the time of the playing storage-backed tweens of the group in one linear pass
+	{
+		SCOPE_CYCLE_COUNTER(STAT_QuickTween_Advance);
+		TweenStorage.Advance(deltaTime, numFixedSteps, GFrameCounter, bIsWorldPaused, group, budget, AdvancedTweens, AdvancedSlots);
+	}
 
-		if (tweenContainer->GetIsPlaying())
+	// ... compute phase: loop, alpha and easing of the opted-in tweens, pure math on worker threads
+	ComputedStates.Reset();
+	ComputedStates.SetNum(AdvancedSlots.Num());
+	{
+		SCOPE_CYCLE_COUNTER(STAT_QuickTween_Ease);
+		ParallelFor(
+			TEXT("QuickTween.Compute"),
+			AdvancedSlots.Num(),
+			ComputeMinBatchSize,
+			[this](int32 index)
+			{
+				const int32 slot = AdvancedSlots[index];
+				if (TweenStorage.HasFlag(slot, EQuickTweenSlotFlags::ParallelCompute))
+				{
+					TweenStorage.Compute(slot, ComputedStates[index]);
+				}
+			},
+			CVarQuickTweenForceSerialCompute.GetValueOnGameThread() ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+	}
+
+	// ... game-thread phase: setters and events
+	for (int32 index = 0; index < AdvancedTweens.Num(); ++index)
+	{
+		// ... an earlier callback this frame may have paused, killed or detached it
+		UQuickTweenBase* tween = AdvancedTweens[index];
+		if (tween->IsInStorage() && tween->GetIsPlaying())
 		{
-			tweenContainer->Update(deltaTime);
+			if (const USceneComponent* source = tween->GetSignificanceSource())
+			{
+				TweenStorage.UpdateInterval[tween->StorageSlot] = static_cast<uint8>(ComputeUpdateInterval(source));
+			}
+			tween->UpdateFromComputedState(ComputedStates[index]);
 		}
+	}
 
+	const int32 numUpdated = AdvancedTweens.Num();
+	const float spentMs = static_cast<float>((FPlatformTime::Seconds() - startTime) * 1000.0);
+	if (numUpdated > 0)
+	{
+		// ... smoothed so a single slow setter doesn't starve the lower priorities for long
+		const float costMs = spentMs / numUpdated;
+		AverageTweenCostMs = AverageTweenCostMs > 0.0f ? FMath::Lerp(AverageTweenCostMs, costMs, 0.1f) : costMs;
 	}
+
+	BudgetStats.SpentMs += spentMs;
+	BudgetStats.NumUpdated += numUpdated;
+	BudgetStats.NumDeferred += budget.NumDeferred;
+	BudgetStats.DeferredMs += budget.NumDeferred * AverageTweenCostMs;
+	BudgetStats.MaxDeferredTime = FMath::Max(BudgetStats.MaxDeferredTime, budget.MaxDeferredTime);
+
+	TweenStorage.RenderLag = 0.0f;
+	AdvancedTweens.Reset();
+	AdvancedSlots.Reset();
 }
 
-TStatId UQuickTweenManager::GetStatId() const
+void UQuickTweenManager::SetTimeChannelScale(FName channel, float timeScale)
 {
-	RETURN_QUICK_DECLARE_CYCLE_STAT(UQuickTweenManager, STATGROUP_Tickables);
+	if (!ensureAlwaysMsgf(timeScale >= 0.0f, TEXT("UQuickTweenManager::SetTimeChannelScale: Time scale must not be negative.")))
+	{
+		return;
+	}
+
+	const int32 index = TweenStorage.FindOrAddTimeChannel(channel);
+	if (TweenStorage.FixedStep > 0.0f)
+	{
+		// ... steps accumulated so far were played at the previous scale
+		for (int32 slot = 0; slot < TweenStorage.Num(); ++slot)
+		{
+			if (TweenStorage.TimeChannel[slot] == index && TweenStorage.AccumulatedSteps[slot] > 0)
+			{
+				TweenStorage.FlushAccumulatedDelta(slot);
+			}
+		}
+	}
+	TweenStorage.TimeChannels[index].TimeScale = timeScale;
 }
 
-void UQuickTweenManager::AddTween(UQuickTweenable* tween)
+void UQuickTweenManager::SetTimeChannelPaused(FName channel, bool bPaused)
 {
-	QuickTweens.Add(tween);
+	TweenStorage.TimeChannels[TweenStorage.FindOrAddTimeChannel(channel)].bIsPaused = bPaused;
 }
 
-void UQuickTweenManager::RemoveTween(class UQuickTweenable* tween)
+float UQuickTweenManager::GetTimeChannelScale(FName channel) const
 {
-	QuickTweens.RemoveSingleSwap(tween);
+	const int32* index = TweenStorage.TimeChannelIndices.Find(channel);
+	return index ? TweenStorage.TimeChannels[*index].TimeScale : 1.0f;
 }
 
-UQuickTweenable* UQuickTweenManager::FindTweenByPredicate(TFunctionRef<bool(UQuickTweenable*)> predicate) const
+bool UQuickTweenManager::IsTimeChannelPaused(FName channel) const
 {
-	UQuickTweenable* const* const ptr = Algo::FindByPredicate(QuickTweens, predicate);
-	return ptr ? *ptr : nullptr;
+	const int32* index = TweenStorage.TimeChannelIndices.Find(channel);
+	return index && TweenStorage.TimeChannels[*index].bIsPaused;
 }
 
-UQuickTweenable* UQuickTweenManager::FindLastTweenByPredicate(TFunctionRef<bool(UQuickTweenable*)> predicate) const
+int32 UQuickTweenManager::ComputeUpdateInterval(const USceneComponent* source)
+{
+	if (SignificanceHook)
+	{
+		return FMath::Clamp(SignificanceHook(source), 1, static_cast<int32>(MAX_uint8));
+	}
+
+	const float baseDistance = CVarQuickTweenLODBaseDistance.GetValueOnGameThread();
+	if (baseDistance <= 0.0f)
+	{
+		return 1;
+	}
+
+	// ... gathered once per frame, shared by every tween and tick group
+	if (ViewLocationsFrame != GFrameCounter)
+	{
+		ViewLocationsFrame = GFrameCounter;
+		ViewLocations.Reset();
+		for (FConstPlayerControllerIterator it = GetWorld()->GetPlayerControllerIterator(); it; ++it)
+		{
+			if (const APlayerController* playerController = it->Get())
+			{
+				FVector location;
+				FRotator rotation;
+				playerController->GetPlayerViewPoint(location, rotation);
+				ViewLocations.Add(location);
+			}
+		}
+	}
+
+	if (ViewLocations.IsEmpty())
+	{
+		return 1;
+	}
+
+	const FVector sourceLocation = source->GetComponentLocation();
+	double minDistanceSquared = TNumericLimits<double>::Max();
+	for (const FVector& viewLocation : ViewLocations)
+	{
+		minDistanceSquared = FMath::Min(minDistanceSquared, FVector::DistSquared(viewLocation, sourceLocation));
+	}
+
+	if (minDistanceSquared > FMath::Square(4.0 * baseDistance))
+	{
+		return 8;
+	}
+	if (minDistanceSquared > FMath::Square(2.0 * baseDistance))
+	{
+		return 4;
+	}
+	if (minDistanceSquared > FMath::Square(static_cast<double>(baseDistance)))
+	{
+		return 2;
+	}
+	return 1;
+}
+
+void UQuickTweenManager::EnsureTickFunction(EQuickTweenTickGroup group)
+{
+	if (group == EQuickTweenTickGroup::Default || group == EQuickTweenTickGroup::Num)
+	{
+		return;
+	}
+
+	FQuickTweenManagerTickFunction& tickFunction = GroupTickFunctions[static_cast<int32>(group)];
+	if (tickFunction.IsTickFunctionRegistered())
+	{
+		return;
+	}
+
+	const uint32 groupBit = 1u << static_cast<uint32>(group);
+	UWorld* world = GetWorld();
+	if (!bIsInitialized || !world || !world->PersistentLevel)
+	{
+		// ... the tweens of the group wait in their bucket until Tick retries
+		UE_LOG(LogQuickTweenManager, Verbose, TEXT("EnsureTickFunction: No level to register the %s tick function in yet, retrying next tick."), *UEnum::GetValueAsString(group));
+		PendingTickGroupMask |= groupBit;
+		return;
+	}
+
+	PendingTickGroupMask &= ~groupBit;
+	RegisterTickFunction(tickFunction, group, ToTickingGroup(group), false);
+	if (group == EQuickTweenTickGroup::Pipelined)
+	{
+		RegisterTickFunction(PipelineSyncTickFunction, group, TG_PostUpdateWork, true);
+		PipelineSyncTickFunction.AddPrerequisite(this, tickFunction);
+	}
+}
+
+void UQuickTweenManager::RegisterTickFunction(FQuickTweenManagerTickFunction& tickFunction, EQuickTweenTickGroup group, ETickingGroup tickingGroup, bool bIsPipelineSync)
 {
-	UQuickTweenable* const* const ptr = Algo::FindLastByPredicate(QuickTweens, predicate);
-	return ptr ? *ptr : nullptr;
+	tickFunction.Manager = this;
+	tickFunction.Group = group;
+	tickFunction.bIsPipelineSync = bIsPipelineSync;
+	tickFunction.TickGroup = tickingGroup;
+	tickFunction.EndTickGroup = tickingGroup;
+	tickFunction.bCanEverTick = true;
+	tickFunction.bStartWithTickEnabled = true;
+	tickFunction.bTickEvenWhenPaused = true; // ... play while paused is resolved per tween
+	tickFunction.RegisterTickFunction(GetWorld()->PersistentLevel);
 }
 
-TArray<UQuickTweenable*> UQuickTweenManager::FindAllTweensByPredicate(TFunctionRef<bool(UQuickTweenable*)> predicate) const
+void FQuickTweenManagerTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
 {
-	TArray<UQuickTweenable*> results;
-	for (UQuickTweenable* tween : QuickTweens)
+	if (Manager)
 	{
-		if (predicate(tween))
+		bIsPipelineSync ? Manager->SyncPipeline() : Manager->TickGroup(DeltaTime, Group);
+	}
+}
+
+FString FQuickTweenManagerTickFunction::DiagnosticMessage()
+{
+	return FString::Printf(TEXT("UQuickTweenManager[%s%s]"), *UEnum::GetValueAsString(Group), bIsPipelineSync ? TEXT(" Sync") : TEXT(""));
+}
+
+void UQuickTweenManager::CompactTweens()
+{
+	check(!bIsTicking);
+	SCOPE_CYCLE_COUNTER(STAT_QuickTween_Compaction);
+
+	// ... storage-backed tweens: only the killed bucket is visited, swap-and-pop is O(1) per dead slot
+	for (int32 group = 0; group < static_cast<int32>(EQuickTweenTickGroup::Num); ++group)
+	{
+		const TArray<int32>& killedSlots = TweenStorage.GetBucket(EQuickTweenBucket::Killed, static_cast<EQuickTweenTickGroup>(group));
+		while (!killedSlots.IsEmpty())
 		{
-			results.Add(tween);
+			const int32 slot = killedSlots.Last();
+			UQuickTweenBase* tween = TweenStorage.Tweens[slot];
+			UntrackTween(tween);
+			TweenStorage.RemoveAtSwap(slot);
+			ReleaseToPool(tween);
+
+			// ... slots released during the tick have no tween, their tween was removed rather than killed
+			if (tween)
+			{
+				INC_DWORD_STAT(STAT_QuickTween_NumKilled);
+			}
 		}
 	}
-	return results;
+
+	// ... other tweenables: one stable pass so the update order is preserved
+	int32 writeIndex = 0;
+	for (int32 readIndex = 0; readIndex < QuickTweens.Num(); ++readIndex)
+	{
+		UQuickTweenable* tween = QuickTweens[readIndex];
+		if (!tween)
+		{
+			continue;
+		}
+
+		if (tween->GetIsPendingKill())
+		{
+			UntrackTween(tween);
+			tween->ManagerSlot = INDEX_NONE;
+			ReleaseToPool(tween);
+			INC_DWORD_STAT(STAT_QuickTween_NumKilled);
+			continue;
+		}
+
+		tween->ManagerSlot = writeIndex;
+		QuickTweens[writeIndex++] = tween;
+	}
+	QuickTweens.SetNum(writeIndex, EAllowShrinking::No);
 }
 
-void UQuickTweenManager::ExecutePredicateByCondition(
-	TFunctionRef<void(UQuickTweenable*)> action,
-	TFunctionRef<bool(const UQuickTweenable*)> predicate) const
+void UQuickTweenManager::EnqueueCreateTween(TFunction<UQuickTweenable*(UObject*)> factory, TFunction<void(const FQuickTweenHandle&)> onCreated)
 {
-	for (UQuickTweenable* tween : QuickTweens)
+	FQuickTweenCommand command;
+	command.Type = FQuickTweenCommand::EType::Create;
+	command.Factory = MoveTemp(factory);
+	command.OnCreated = MoveTemp(onCreated);
+	Commands.Enqueue(MoveTemp(command));
+}
+
+void UQuickTweenManager::EnqueuePlay(const FQuickTweenHandle& handle)
+{
+	EnqueueHandleCommand(FQuickTweenCommand::EType::Play, handle);
+}
+
+void UQuickTweenManager::EnqueuePause(const FQuickTweenHandle& handle)
+{
+	EnqueueHandleCommand(FQuickTweenCommand::EType::Pause, handle);
+}
+
+void UQuickTweenManager::EnqueueKill(const FQuickTweenHandle& handle)
+{
+	EnqueueHandleCommand(FQuickTweenCommand::EType::Kill, handle);
+}
+
+void UQuickTweenManager::EnqueueHandleCommand(FQuickTweenCommand::EType type, const FQuickTweenHandle& handle)
+{
+	FQuickTweenCommand command;
+	command.Type = type;
+	command.Handle = handle;
+	Commands.Enqueue(MoveTemp(command));
+}
+
+void UQuickTweenManager::ExecuteCommands()
+{
+	check(IsInGameThread() && !bIsTicking);
+
+	FQuickTweenCommand command;
+	while (Commands.Dequeue(command))
+	{
+		switch (command.Type)
+		{
+		case FQuickTweenCommand::EType::Create:
+			if (UQuickTweenable* tween = command.Factory ? command.Factory(this) : nullptr)
+			{
+				if (command.OnCreated)
+				{
+					command.OnCreated(tween->GetTweenHandle());
+				}
+			}
+			else
+			{
+				UE_LOG(LogQuickTweenManager, Warning, TEXT("ExecuteCommands: A queued factory did not create a tween."));
+			}
+			break;
+		case FQuickTweenCommand::EType::Play:
+			command.Handle.Play();
+			break;
+		case FQuickTweenCommand::EType::Pause:
+			command.Handle.Pause();
+			break;
+		case FQuickTweenCommand::EType::Kill:
+			command.Handle.Kill();
+			break;
+		}
+	}
+}
+
+void UQuickTweenManager::FlushPendingAdds()
+{
+	check(!bIsTicking);
+
+	for (UQuickTweenable* tween : PendingAdds)
+	{
+		// ... removed again before the flush, or queued twice
+		if (tween->ManagerSlot != PendingSlot)
+		{
+			continue;
+		}
+		tween->ManagerSlot = INDEX_NONE;
+		RegisterTween(tween);
+	}
+	PendingAdds.Reset();
+}
+
+bool UQuickTweenManager::IsTickable() const
+{
+	// ... tweens that don't play while paused can't advance, no need to tick for them
+	const UWorld* world = GetWorld();
+	const bool bIsWorldPaused = world && world->IsPaused();
+	if ((!bIsWorldPaused && TweenStorage.NumInBucket(EQuickTweenBucket::Playing, EQuickTweenTickGroup::Default) > 0) ||
+		TweenStorage.NumInBucket(EQuickTweenBucket::PlayingWhilePaused, EQuickTweenTickGroup::Default) > 0 ||
+		NativeTweens.Num() > 0 || !Commands.IsEmpty() || PendingTickGroupMask != 0)
+	{
+		return true;
+	}
+
+	// ... killed tweens of every group are compacted here
+	for (int32 group = 0; group < static_cast<int32>(EQuickTweenTickGroup::Num); ++group)
+	{
+		if (TweenStorage.NumInBucket(EQuickTweenBucket::Killed, static_cast<EQuickTweenTickGroup>(group)) > 0)
+		{
+			return true;
+		}
+	}
+
+	// ... sequences are few, checking them directly is cheaper than tracking their transitions
+	return Algo::AnyOf(QuickTweens, [](const UQuickTweenable* tween)
+	{
+		return tween && (tween->GetIsPlaying() || tween->GetIsPendingKill());
+	});
+}
+
+TStatId UQuickTweenManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UQuickTweenManager, STATGROUP_QuickTween);
+}
+
+void UQuickTweenManager::AddTween(UQuickTweenable* tween)
+{
+	if (!tween || tween->ManagerSlot != INDEX_NONE)
+	{
+		return;
+	}
+
+	UQuickTweenBase* baseTween = Cast<UQuickTweenBase>(tween);
+	if (baseTween && baseTween->IsInStorage())
+	{
+		return;
+	}
+
+	// ... tracked right away so the handle and tag lookups work before the queue is flushed
+	TrackTween(tween);
+	INC_DWORD_STAT(STAT_QuickTween_NumCreated);
+	QUICKTWEEN_TRACE_LIFECYCLE(tween, Create);
+
+	if (bIsTicking)
+	{
+		tween->ManagerSlot = PendingSlot;
+		PendingAdds.Add(tween);
+		return;
+	}
+	RegisterTween(tween);
+}
+
+void UQuickTweenManager::RegisterTween(UQuickTweenable* tween)
+{
+	if (UQuickTweenBase* baseTween = Cast<UQuickTweenBase>(tween))
+	{
+		TweenStorage.Add(baseTween);
+		// ... the group may have been set before the tween was registered
+		EnsureTickFunction(baseTween->TickGroup);
+		return;
+	}
+	tween->ManagerSlot = QuickTweens.Add(tween);
+}
+
+void UQuickTweenManager::RemoveTween(class UQuickTweenable* tween)
+{
+	if (!tween)
+	{
+		return;
+	}
+
+	if (tween->ManagerSlot == PendingSlot)
+	{
+		// ... still queued, FlushPendingAdds skips it
+		UntrackTween(tween);
+		tween->ManagerSlot = INDEX_NONE;
+		return;
+	}
+
+	if (UQuickTweenBase* baseTween = Cast<UQuickTweenBase>(tween))
+	{
+		const int32 slot = baseTween->StorageSlot;
+		if (baseTween->Storage == &TweenStorage && TweenStorage.Tweens.IsValidIndex(slot) && TweenStorage.Tweens[slot] == baseTween)
+		{
+			UntrackTween(baseTween);
+			bIsTicking ? TweenStorage.Release(slot) : TweenStorage.RemoveAtSwap(slot);
+		}
+		return;
+	}
+
+	const int32 slot = tween->ManagerSlot;
+	if (!QuickTweens.IsValidIndex(slot) || QuickTweens[slot] != tween)
+	{
+		return;
+	}
+
+	UntrackTween(tween);
+	tween->ManagerSlot = INDEX_NONE;
+	if (bIsTicking)
+	{
+		QuickTweens[slot] = nullptr;
+		return;
+	}
+
+	QuickTweens.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	if (QuickTweens.IsValidIndex(slot) && QuickTweens[slot])
+	{
+		QuickTweens[slot]->ManagerSlot = slot;
+	}
+}
+
+void UQuickTweenManager::ForEachTween(TFunctionRef<bool(UQuickTweenable*)> func) const
+{
+	for (UQuickTweenBase* tween : TweenStorage.Tweens)
+	{
+		if (tween && !func(tween))
+		{
+			return;
+		}
+	}
+
+	for (UQuickTweenable* tween : QuickTweens)
+	{
+		if (tween && !func(tween))
+		{
+			return;
+		}
+	}
+
+	for (UQuickTweenable* tween : PendingAdds)
+	{
+		if (tween->ManagerSlot == PendingSlot && !func(tween))
+		{
+			return;
+		}
+	}
+}
+
+void UQuickTweenManager::PrewarmPool(TSubclassOf<UQuickTweenable> tweenClass, int32 count)
+{
+	if (!tweenClass || tweenClass->HasAnyClassFlags(CLASS_Abstract))
+	{
+		UE_LOG(LogQuickTweenManager, Warning, TEXT("PrewarmPool: A concrete tween class is required."));
+		return;
+	}
+	TweenPool.Prewarm(tweenClass, count, this);
+}
+
+SIZE_T UQuickTweenManager::GetAllocatedSize() const
+{
+	return TweenStorage.GetAllocatedSize() + NativeTweens.GetAllocatedSize() + QuickTweens.GetAllocatedSize() +
+		PendingAdds.GetAllocatedSize() + TweensByTag.GetAllocatedSize() + TweensByTarget.GetAllocatedSize() + SequenceTweensByTarget.GetAllocatedSize() + SweptTargets.GetAllocatedSize() + AdvancedTweens.GetAllocatedSize() +
+		AdvancedSlots.GetAllocatedSize() + ComputedStates.GetAllocatedSize() + ViewLocations.GetAllocatedSize() +
+		PipelineTweens.GetAllocatedSize() + PipelineSlots.GetAllocatedSize() + PipelineInputs.GetAllocatedSize() + PipelineStates.GetAllocatedSize();
+}
+
+void UQuickTweenManager::ReleaseToPool(UQuickTweenable* tween)
+{
+	// ... tweens created while pooling was disabled are left to the garbage collector
+	if (tween && tween->bIsPooled)
+	{
+		TweenPool.Release(tween);
+	}
+}
+
+void UQuickTweenManager::TrackTween(UQuickTweenable* tween)
+{
+	tween->TweenHandle = FQuickTweenHandleRegistry::Issue(tween);
+	TrackTarget(tween);
+	if (tween->IsA<UQuickTweenSequence>())
+	{
+		TrackSequenceTargets(tween);
+	}
+
+	const FName tag = tween->GetTweenTagName();
+	if (tag.IsNone())
+	{
+		return;
+	}
+
+	ForEachTagLevel(tag, [this, tween](FName key)
+	{
+		TweensByTag.Add(key, TWeakObjectPtr<UQuickTweenable>(tween));
+	});
+}
+
+void UQuickTweenManager::UntrackTween(UQuickTweenable* tween)
+{
+	if (!tween)
+	{
+		return;
+	}
+
+	FQuickTweenHandleRegistry::Release(tween->TweenHandle);
+	tween->TweenHandle.Reset();
+	ReleasePropertyClaims(tween);
+	UntrackTarget(tween);
+	if (tween->IsA<UQuickTweenSequence>())
+	{
+		UntrackSequenceTargets(tween);
+	}
+	RemoveFromGroup(tween);
+
+	const FName tag = tween->GetTweenTagName();
+	if (tag.IsNone())
+	{
+		return;
+	}
+
+	ForEachTagLevel(tag, [this, tween](FName key)
+	{
+		TweensByTag.RemoveSingle(key, TWeakObjectPtr<UQuickTweenable>(tween));
+	});
+}
+
+void UQuickTweenManager::TrackTarget(UQuickTweenable* tween)
+{
+	const UQuickTweenBase* baseTween = Cast<UQuickTweenBase>(tween);
+	UObject* target = baseTween ? baseTween->Target.Get() : nullptr;
+	if (!target)
+	{
+		return;
+	}
+
+	TweensByTarget.Add(TWeakObjectPtr<const UObject>(target), TWeakObjectPtr<UQuickTweenable>(tween));
+
+	// ... actors are watched so their tweens die with EndPlay instead of at the next garbage collection,
+	// components are swept as well since they can be destroyed while their actor stays alive
+	AActor* actor = Cast<AActor>(target);
+	if (!actor)
+	{
+		++SweptTargets.FindOrAdd(TWeakObjectPtr<const UObject>(target));
+
+		const UActorComponent* component = Cast<UActorComponent>(target);
+		actor = component ? component->GetOwner() : nullptr;
+	}
+
+	if (!actor)
+	{
+		return;
+	}
+
+	bool bIsAlreadyWatched = false;
+	WatchedActors.Add(TWeakObjectPtr<AActor>(actor), &bIsAlreadyWatched);
+	if (!bIsAlreadyWatched)
+	{
+		actor->OnEndPlay.AddDynamic(this, &UQuickTweenManager::HandleTargetActorEndPlay);
+	}
+}
+
+void UQuickTweenManager::UntrackTarget(UQuickTweenable* tween)
+{
+	// ... the key compares by object index and serial number, so it is found even once the target is gone
+	const UQuickTweenBase* baseTween = Cast<UQuickTweenBase>(tween);
+	if (!baseTween || baseTween->Target.IsExplicitlyNull())
+	{
+		return;
+	}
+
+	const TWeakObjectPtr<const UObject> target(baseTween->Target);
+	if (TweensByTarget.RemoveSingle(target, TWeakObjectPtr<UQuickTweenable>(tween)) == 0)
+	{
+		return;
+	}
+
+	// ... only non-actor targets were counted, the lookup misses for actors
+	if (int32* numTweens = SweptTargets.Find(target); numTweens && --*numTweens == 0)
+	{
+		SweptTargets.Remove(target);
+	}
+}
+
+void UQuickTweenManager::RetargetTween(UQuickTweenBase* tween, UObject* target)
+{
+	if (!tween)
+	{
+		return;
+	}
+
+	// ... only registered tweens and the tweens of registered sequences are indexed
+	const bool bIsTracked = tween->TweenHandle.IsSet();
+	const bool bIsSequenceTracked = !bIsTracked && !tween->Target.IsExplicitlyNull() &&
+		SequenceTweensByTarget.RemoveSingle(TWeakObjectPtr<const UObject>(tween->Target), TWeakObjectPtr<UQuickTweenBase>(tween)) > 0;
+	if (bIsTracked)
+	{
+		UntrackTarget(tween);
+	}
+	tween->Target = target;
+	if (bIsTracked)
+	{
+		TrackTarget(tween);
+	}
+	else if (bIsSequenceTracked && target)
+	{
+		SequenceTweensByTarget.Add(TWeakObjectPtr<const UObject>(target), TWeakObjectPtr<UQuickTweenBase>(tween));
+	}
+}
+
+void UQuickTweenManager::TrackSequenceTween(UQuickTweenable* tween)
+{
+	if (tween && GetRootOwner(tween)->TweenHandle.IsSet())
+	{
+		TrackSequenceTargets(tween);
+	}
+}
+
+void UQuickTweenManager::TrackSequenceTargets(UQuickTweenable* tween)
+{
+	if (const UQuickTweenSequence* sequence = Cast<UQuickTweenSequence>(tween))
+	{
+		sequence->ForEachTween([this](UQuickTweenable* child) { TrackSequenceTargets(child); });
+		return;
+	}
+
+	UQuickTweenBase* baseTween = Cast<UQuickTweenBase>(tween);
+	if (const UObject* target = baseTween ? baseTween->Target.Get() : nullptr)
+	{
+		SequenceTweensByTarget.Add(TWeakObjectPtr<const UObject>(target), TWeakObjectPtr<UQuickTweenBase>(baseTween));
+	}
+}
+
+void UQuickTweenManager::UntrackSequenceTargets(UQuickTweenable* tween)
+{
+	if (const UQuickTweenSequence* sequence = Cast<UQuickTweenSequence>(tween))
+	{
+		sequence->ForEachTween([this](UQuickTweenable* child) { UntrackSequenceTargets(child); });
+		return;
+	}
+
+	// ... the key compares by object index and serial number, so it is found even once the target is gone
+	UQuickTweenBase* baseTween = Cast<UQuickTweenBase>(tween);
+	if (baseTween && !baseTween->Target.IsExplicitlyNull())
+	{
+		SequenceTweensByTarget.RemoveSingle(TWeakObjectPtr<const UObject>(baseTween->Target), TWeakObjectPtr<UQuickTweenBase>(baseTween));
+	}
+}
+
+void UQuickTweenManager::ClaimProperty(UQuickTweenBase* tween, UObject* target, FName channel)
+{
+	if (!tween)
+	{
+		return;
+	}
+
+	ReleasePropertyClaims(tween);
+	RetargetTween(tween, target);
+	tween->PropertyChannel = channel;
+	tween->YieldedTo.Reset();
+
+	// ... autoplayed tweens started before their property was known
+	const EQuickTweenState state = tween->GetTweenState();
+	if (state == EQuickTweenState::Play || state == EQuickTweenState::Pause)
+	{
+		ResolvePropertyConflicts(tween);
+	}
+}
+
+void UQuickTweenManager::ResolvePropertyConflicts(UQuickTweenable* tween)
+{
+	if (!tween || ConflictPolicy == EQuickTweenConflictPolicy::Ignore)
+	{
+		return;
+	}
+
+	if (const UQuickTweenSequence* sequence = Cast<UQuickTweenSequence>(tween))
+	{
+		sequence->ForEachTween([this](UQuickTweenable* child) { ResolvePropertyConflicts(child); });
+		return;
+	}
+
+	UQuickTweenBase* claimant = Cast<UQuickTweenBase>(tween);
+	const UObject* target = claimant ? claimant->Target.Get() : nullptr;
+	if (!target || claimant->PropertyChannel.IsNone())
+	{
+		return;
+	}
+
+	// ... snapshot of the writer and the tween or sequence playing it, OnComplete and OnKilled callbacks may add or remove tweens
+	const TWeakObjectPtr<const UObject> key(target);
+	TArray<TPair<UQuickTweenBase*, UQuickTweenable*>> previousTweens;
+	for (auto it = TweensByTarget.CreateConstKeyIterator(key); it; ++it)
+	{
+		UQuickTweenBase* previous = Cast<UQuickTweenBase>(it.Value().Get());
+		if (previous && previous != claimant && previous->PropertyChannel == claimant->PropertyChannel && IsRunning(previous))
+		{
+			previousTweens.Emplace(previous, previous);
+		}
+	}
+
+	// ... tweens of the claimant's own sequence never conflict
+	const UQuickTweenable* claimantRoot = GetRootOwner(claimant);
+	for (auto it = SequenceTweensByTarget.CreateConstKeyIterator(key); it; ++it)
+	{
+		UQuickTweenBase* previous = it.Value().Get();
+		if (!previous || previous == claimant || previous->PropertyChannel != claimant->PropertyChannel)
+		{
+			continue;
+		}
+
+		UQuickTweenable* sequence = GetRootOwner(previous);
+		if (sequence != claimantRoot && IsRunning(sequence))
+		{
+			previousTweens.Emplace(previous, sequence);
+		}
+	}
+
+	for (const TPair<UQuickTweenBase*, UQuickTweenable*>& pair : previousTweens)
+	{
+		UQuickTweenable* running = pair.Value;
+		switch (ConflictPolicy)
+		{
+		case EQuickTweenConflictPolicy::Blend:
+			pair.Key->YieldedTo = claimant;
+			break;
+		case EQuickTweenConflictPolicy::CompletePrevious:
+			// ... a sequence with several conflicting tweens is completed once, infinite loops can't complete so are killed
+			if (!IsRunning(running))
+			{
+				break;
+			}
+			if (running->GetLoops() != INFINITE_LOOPS)
+			{
+				running->Complete(true);
+				break;
+			}
+			running->Kill();
+			break;
+		default:
+			if (IsRunning(running))
+			{
+				running->Kill();
+			}
+			break;
+		}
+	}
+}
+
+void UQuickTweenManager::ReleasePropertyClaims(const UQuickTweenable* tween)
+{
+	if (const UQuickTweenSequence* sequence = Cast<UQuickTweenSequence>(tween))
+	{
+		sequence->ForEachTween([this](const UQuickTweenable* child) { ReleasePropertyClaims(child); });
+		return;
+	}
+
+	const UQuickTweenBase* claimant = Cast<UQuickTweenBase>(tween);
+	if (!claimant || claimant->PropertyChannel.IsNone() || claimant->Target.IsExplicitlyNull())
+	{
+		return;
+	}
+
+	const TWeakObjectPtr<const UObject> key(claimant->Target);
+	for (auto it = TweensByTarget.CreateConstKeyIterator(key); it; ++it)
+	{
+		UQuickTweenBase* yielded = Cast<UQuickTweenBase>(it.Value().Get());
+		if (yielded && yielded->YieldedTo.Get() == claimant)
+		{
+			yielded->YieldedTo.Reset();
+		}
+	}
+
+	for (auto it = SequenceTweensByTarget.CreateConstKeyIterator(key); it; ++it)
+	{
+		UQuickTweenBase* yielded = it.Value().Get();
+		if (yielded && yielded->YieldedTo.Get() == claimant)
+		{
+			yielded->YieldedTo.Reset();
+		}
+	}
+}
+
+UQuickTweenGroup* UQuickTweenManager::CreateGroup(FName name)
+{
+	UQuickTweenGroup* group = NewObject<UQuickTweenGroup>(this);
+	group->Manager = this;
+	group->GroupName = name;
+	return group;
+}
+
+void UQuickTweenManager::AddToGroup(UQuickTweenGroup* group, UQuickTweenable* tween)
+{
+	if (!group || !tween || tween->Group.Get() == group)
+	{
+		return;
+	}
+
+	// ... only registered tweens leave their group again when unregistered
+	if (!ensureAlwaysMsgf(tween->TweenHandle.IsSet(), TEXT("UQuickTweenManager::AddToGroup: Only tweens registered with a manager can join a group.")))
+	{
+		return;
+	}
+
+	RemoveFromGroup(tween);
+	tween->Group = group;
+	tween->GroupSlot = group->Members.Add(tween);
+}
+
+void UQuickTweenManager::RemoveFromGroup(UQuickTweenable* tween)
+{
+	if (!tween)
+	{
+		return;
+	}
+
+	UQuickTweenGroup* group = tween->Group.Get();
+	const int32 slot = tween->GroupSlot;
+	if (group && group->Members.IsValidIndex(slot) && group->Members[slot] == tween)
+	{
+		group->Members.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+		if (group->Members.IsValidIndex(slot) && group->Members[slot])
+		{
+			group->Members[slot]->GroupSlot = slot;
+		}
+	}
+	tween->Group.Reset();
+	tween->GroupSlot = INDEX_NONE;
+}
+
+int32 UQuickTweenManager::KillTweensOf(const UObject* target)
+{
+	if (!target)
+	{
+		return 0;
+	}
+
+	// ... snapshot, OnKilled callbacks may add or remove tweens
+	TArray<UQuickTweenable*> tweens;
+	for (auto it = TweensByTarget.CreateConstKeyIterator(TWeakObjectPtr<const UObject>(target)); it; ++it)
+	{
+		UQuickTweenable* tween = it.Value().Get();
+		if (tween && !tween->GetIsPendingKill())
+		{
+			tweens.Add(tween);
+		}
+	}
+
+	for (UQuickTweenable* tween : tweens)
+	{
+		tween->Kill();
+	}
+	return tweens.Num();
+}
+
+void UQuickTweenManager::HandleTargetActorEndPlay(AActor* actor, EEndPlayReason::Type endPlayReason)
+{
+	WatchedActors.Remove(TWeakObjectPtr<AActor>(actor));
+	if (!actor)
+	{
+		return;
+	}
+
+	KillTweensOf(actor);
+	for (const UActorComponent* component : actor->GetComponents())
+	{
+		KillTweensOf(component);
+	}
+}
+
+void UQuickTweenManager::HandlePostGarbageCollect()
+{
+	// ... target index entries are removed as the killed tweens are compacted
+	TArray<UQuickTweenable*> tweens;
+	auto gatherTweensOf = [this, &tweens](const TWeakObjectPtr<const UObject>& target)
+	{
+		for (auto it = TweensByTarget.CreateConstKeyIterator(target); it; ++it)
+		{
+			UQuickTweenable* tween = it.Value().Get();
+			if (tween && !tween->GetIsPendingKill())
+			{
+				tweens.Add(tween);
+			}
+		}
+	};
+
+	for (const TPair<TWeakObjectPtr<const UObject>, int32>& pair : SweptTargets)
+	{
+		if (pair.Key.IsStale())
+		{
+			gatherTweensOf(pair.Key);
+		}
+	}
+
+	// ... an actor collected without ending play never reported it, kill its tweens before forgetting it
+	for (auto it = WatchedActors.CreateIterator(); it; ++it)
+	{
+		if (it->IsStale())
+		{
+			gatherTweensOf(TWeakObjectPtr<const UObject>(*it));
+			it.RemoveCurrent();
+		}
+	}
+
+	for (UQuickTweenable* tween : tweens)
+	{
+		tween->Kill();
+	}
+}
+
+bool UQuickTweenManager::MatchesTagQuery(const UQuickTweenable* tween, FName tag, bool bMatchChildTags)
+{
+	// ... every entry under the key is the tag itself or one of its children
+	return tween && !tween->GetIsPendingKill() && (bMatchChildTags || tween->GetTweenTagName() == tag);
+}
+
+UQuickTweenable* UQuickTweenManager::FindTweenByTag(FName tag, bool bMatchChildTags) const
+{
+	for (auto it = TweensByTag.CreateConstKeyIterator(tag); it; ++it)
+	{
+		UQuickTweenable* tween = it.Value().Get();
+		if (MatchesTagQuery(tween, tag, bMatchChildTags))
+		{
+			return tween;
+		}
+	}
+	return nullptr;
+}
+
+void UQuickTweenManager::FindAllTweensByTag(FName tag, TArray<UQuickTweenable*>& outTweens, bool bMatchChildTags) const
+{
+	for (auto it = TweensByTag.CreateConstKeyIterator(tag); it; ++it)
+	{
+		UQuickTweenable* tween = it.Value().Get();
+		if (MatchesTagQuery(tween, tag, bMatchChildTags))
+		{
+			outTweens.Add(tween);
+		}
+	}
+}
+
+void UQuickTweenManager::ExecuteActionByTag(FName tag, TFunctionRef<void(UQuickTweenable*)> action, bool bMatchChildTags) const
+{
+	// ... snapshot, the action may add or remove tweens
+	TArray<UQuickTweenable*> tweens;
+	FindAllTweensByTag(tag, tweens, bMatchChildTags);
+	for (UQuickTweenable* tween : tweens)
+	{
+		action(tween);
+	}
+}
+
+UQuickTweenable* UQuickTweenManager::FindTweenByPredicate(TFunctionRef<bool(UQuickTweenable*)> predicate) const
+{
+	UQuickTweenable* result = nullptr;
+	ForEachTween([&result, &predicate](UQuickTweenable* tween)
+	{
+		if (predicate(tween))
+		{
+			result = tween;
+			return false;
+		}
+		return true;
+	});
+	return result;
+}
+
+UQuickTweenable* UQuickTweenManager::FindLastTweenByPredicate(TFunctionRef<bool(UQuickTweenable*)> predicate) const
+{
+	UQuickTweenable* result = nullptr;
+	ForEachTween([&result, &predicate](UQuickTweenable* tween)
+	{
+		if (predicate(tween))
+		{
+			result = tween;
+		}
+		return true;
+	});
+	return result;
+}
+
+TArray<UQuickTweenable*> UQuickTweenManager::FindAllTweensByPredicate(TFunctionRef<bool(UQuickTweenable*)> predicate) const
+{
+	TArray<UQuickTweenable*> results;
+	ForEachTween([&results, &predicate](UQuickTweenable* tween)
+	{
+		if (predicate(tween))
+		{
+			results.Add(tween);
+		}
+		return true;
+	});
+	return results;
+}
+
+void UQuickTweenManager::ExecutePredicateByCondition(
+	TFunctionRef<void(UQuickTweenable*)> action,
+	TFunctionRef<bool(const UQuickTweenable*)> predicate) const
+{
+	// ... snapshot, the action may add or remove tweens
+	TArray<UQuickTweenable*> tweens;
+	tweens.Reserve(TweenStorage.Num() + QuickTweens.Num() + PendingAdds.Num());
+	ForEachTween([&tweens](UQuickTweenable* tween)
+	{
+		tweens.Add(tween);
+		return true;
+	});
+
+	for (UQuickTweenable* tween : tweens)
 	{
 		if (predicate(tween))
 		{
@@ -0,0 +1,77 @@
+﻿// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+
+#include "QuickTweenPool.h"
+#include "QuickTweenable.h"
+#include "QuickTweenStats.h"
+
+UQuickTweenable* FQuickTweenPool::Acquire(UClass* tweenClass, UObject* outer)
+{
+	check(tweenClass && tweenClass->IsChildOf<UQuickTweenable>());
+
+	FQuickTweenPoolBucket& bucket = Buckets.FindOrAdd(tweenClass);
+	FQuickTweenPoolStats& stats = bucket.Stats;
+
+	UQuickTweenable* tween = nullptr;
+	if (bucket.Free.IsEmpty())
+	{
+		tween = NewObject<UQuickTweenable>(outer, tweenClass);
+		++stats.NumAllocated;
+	}
+	else
+	{
+		tween = bucket.Free.Pop(EAllowShrinking::No);
+		++stats.NumReused;
+		INC_DWORD_STAT(STAT_QuickTween_NumPoolHits);
+	}
+
+	tween->bIsPooled = true;
+	stats.NumFree = bucket.Free.Num();
+	stats.HighWaterMark = FMath::Max(stats.HighWaterMark, ++stats.NumActive);
+	return tween;
+}
+
+void FQuickTweenPool::Release(UQuickTweenable* tween)
+{
+	check(tween && tween->bIsPooled);
+
+	FQuickTweenPoolBucket& bucket = Buckets.FindOrAdd(tween->GetClass());
+	tween->ResetForReuse();
+	bucket.Free.Add(tween);
+	bucket.Stats.NumFree = bucket.Free.Num();
+	--bucket.Stats.NumActive;
+}
+
+void FQuickTweenPool::Prewarm(UClass* tweenClass, int32 count, UObject* outer)
+{
+	check(tweenClass && tweenClass->IsChildOf<UQuickTweenable>());
+
+	FQuickTweenPoolBucket& bucket = Buckets.FindOrAdd(tweenClass);
+	bucket.Free.Reserve(count);
+	while (bucket.Free.Num() < count)
+	{
+		UQuickTweenable* tween = NewObject<UQuickTweenable>(outer, tweenClass);
+		tween->bIsPooled = true;
+		bucket.Free.Add(tween);
+		++bucket.Stats.NumAllocated;
+	}
+	bucket.Stats.NumFree = bucket.Free.Num();
+}
+
+const FQuickTweenPoolStats* FQuickTweenPool::FindStats(const UClass* tweenClass) const
+{
+	const FQuickTweenPoolBucket* bucket = Buckets.Find(tweenClass);
+	return bucket ? &bucket->Stats : nullptr;
+}
+
+void FQuickTweenPool::ForEachStats(TFunctionRef<void(const UClass*, const FQuickTweenPoolStats&)> func) const
+{
+	for (const TPair<UClass*, FQuickTweenPoolBucket>& pair : Buckets)
+	{
+		func(pair.Key, pair.Value.Stats);
+	}
+}
+
+void FQuickTweenPool::Reset()
+{
+	Buckets.Reset();
+}
@@ -0,0 +1,28 @@
+﻿// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+/**
+ * Stats of the tween module, shown with "stat QuickTween".
+ * Cycle counters split the frame time by phase, the counters are reset every frame.
+ */
+DECLARE_STATS_GROUP(TEXT("QuickTween"), STATGROUP_QuickTween, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Time Advance"), STAT_QuickTween_Advance, STATGROUP_QuickTween, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ease Evaluation"), STAT_QuickTween_Ease, STATGROUP_QuickTween, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Setter Execution"), STAT_QuickTween_Setters, STATGROUP_QuickTween, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Event Broadcast"), STAT_QuickTween_Events, STATGROUP_QuickTween, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Sequence SeekTime"), STAT_QuickTween_SequenceSeek, STATGROUP_QuickTween, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Compaction"), STAT_QuickTween_Compaction, STATGROUP_QuickTween, );
+
+// ... bucket counts cover the storage-backed tweens of every tick group
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active Tweens"), STAT_QuickTween_NumActive, STATGROUP_QuickTween, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Playing Tweens"), STAT_QuickTween_NumPlaying, STATGROUP_QuickTween, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Paused Tweens"), STAT_QuickTween_NumPaused, STATGROUP_QuickTween, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Idle Tweens"), STAT_QuickTween_NumIdle, STATGROUP_QuickTween, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Created Tweens"), STAT_QuickTween_NumCreated, STATGROUP_QuickTween, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Killed Tweens"), STAT_QuickTween_NumKilled, STATGROUP_QuickTween, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Pool Hits"), STAT_QuickTween_NumPoolHits, STATGROUP_QuickTween, );
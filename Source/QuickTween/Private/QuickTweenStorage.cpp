@@ -0,0 +1,385 @@
+﻿// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+
+#include "QuickTweenStorage.h"
+#include "Tweens/QuickTweenBase.h"
+
+int32 FQuickTweenStorage::Add(UQuickTweenBase* tween)
+{
+	check(tween && !tween->IsInStorage());
+
+	const int32 slot = Tweens.Add(tween);
+	State.Add(tween->TweenState);
+	Flags.Add(EQuickTweenSlotFlags::None);
+	ElapsedTime.Add(tween->ElapsedTime);
+	Duration.Add(tween->Duration);
+	TimeScale.Add(tween->TimeScale);
+	Loops.Add(tween->Loops);
+	CurrentLoop.Add(tween->CurrentLoop);
+	LoopType.Add(tween->LoopType);
+	EaseType.Add(tween->EaseType);
+	EaseCurve.Add(tween->EaseCurve);
+	TickGroup.Add(tween->TickGroup);
+	Priority.Add(tween->Priority);
+	AccumulatedDelta.Add(0.0f);
+	AccumulatedSteps.Add(0);
+	TimeChannel.Add(FindOrAddTimeChannel(tween->TimeChannel));
+	UpdateInterval.Add(1);
+	UpdatePhase.Add(NextUpdatePhase++);
+	Bucket.Add(EQuickTweenBucket::Num);
+	BucketIndex.Add(INDEX_NONE);
+
+	Flags[slot] |= tween->bIsReversed ? EQuickTweenSlotFlags::Reversed : EQuickTweenSlotFlags::None;
+	Flags[slot] |= tween->bPlayWhilePaused ? EQuickTweenSlotFlags::PlayWhilePaused : EQuickTweenSlotFlags::None;
+	Flags[slot] |= tween->bAutoKill ? EQuickTweenSlotFlags::AutoKill : EQuickTweenSlotFlags::None;
+	Flags[slot] |= tween->bComputeInParallel ? EQuickTweenSlotFlags::ParallelCompute : EQuickTweenSlotFlags::None;
+	AddToBucket(slot, ComputeBucket(slot));
+
+	tween->Storage = this;
+	tween->StorageSlot = slot;
+	return slot;
+}
+
+void FQuickTweenStorage::Detach(int32 slot)
+{
+	// ... copy the hot state back so the tween keeps working once detached
+	FlushAccumulatedDelta(slot);
+	if (UQuickTweenBase* tween = Tweens[slot])
+	{
+		tween->TweenState = State[slot];
+		tween->ElapsedTime = ElapsedTime[slot];
+		tween->CurrentLoop = CurrentLoop[slot];
+		tween->bIsReversed = HasFlag(slot, EQuickTweenSlotFlags::Reversed);
+		tween->Storage = nullptr;
+		tween->StorageSlot = INDEX_NONE;
+	}
+}
+
+void FQuickTweenStorage::RemoveAtSwap(int32 slot)
+{
+	check(Tweens.IsValidIndex(slot));
+
+	Detach(slot);
+	RemoveFromBucket(slot);
+
+	Tweens.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	State.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	Flags.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	ElapsedTime.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	Duration.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	TimeScale.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	Loops.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	CurrentLoop.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	LoopType.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	EaseType.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	EaseCurve.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	TickGroup.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	Priority.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	AccumulatedDelta.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	AccumulatedSteps.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	TimeChannel.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	UpdateInterval.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	UpdatePhase.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	Bucket.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+	BucketIndex.RemoveAtSwap(slot, 1, EAllowShrinking::No);
+
+	// ... the last slot was moved into the freed one
+	if (Tweens.IsValidIndex(slot))
+	{
+		Buckets[static_cast<int32>(TickGroup[slot])][static_cast<int32>(Bucket[slot])][BucketIndex[slot]] = slot;
+		if (Tweens[slot])
+		{
+			Tweens[slot]->StorageSlot = slot;
+		}
+	}
+}
+
+void FQuickTweenStorage::Release(int32 slot)
+{
+	check(Tweens.IsValidIndex(slot));
+
+	Detach(slot);
+	Tweens[slot] = nullptr;
+	SetState(slot, EQuickTweenState::Kill);
+}
+
+void FQuickTweenStorage::Reset()
+{
+	for (int32 slot = Num() - 1; slot >= 0; --slot)
+	{
+		RemoveAtSwap(slot);
+	}
+}
+
+SIZE_T FQuickTweenStorage::GetAllocatedSize() const
+{
+	SIZE_T size = Tweens.GetAllocatedSize() + State.GetAllocatedSize() + Flags.GetAllocatedSize() +
+		ElapsedTime.GetAllocatedSize() + Duration.GetAllocatedSize() + TimeScale.GetAllocatedSize() +
+		Loops.GetAllocatedSize() + CurrentLoop.GetAllocatedSize() + LoopType.GetAllocatedSize() +
+		EaseType.GetAllocatedSize() + EaseCurve.GetAllocatedSize() + TickGroup.GetAllocatedSize() +
+		Priority.GetAllocatedSize() + AccumulatedDelta.GetAllocatedSize() + AccumulatedSteps.GetAllocatedSize() +
+		TimeChannel.GetAllocatedSize() + UpdateInterval.GetAllocatedSize() + UpdatePhase.GetAllocatedSize() +
+		Bucket.GetAllocatedSize() + BucketIndex.GetAllocatedSize() +
+		TimeChannels.GetAllocatedSize() + TimeChannelIndices.GetAllocatedSize() + ChannelDeltas.GetAllocatedSize();
+
+	for (const auto& groupBuckets : Buckets)
+	{
+		for (const TArray<int32>& bucket : groupBuckets)
+		{
+			size += bucket.GetAllocatedSize();
+		}
+	}
+	for (const TArray<int32>& candidates : BudgetCandidates)
+	{
+		size += candidates.GetAllocatedSize();
+	}
+	return size;
+}
+
+void FQuickTweenStorage::SetState(int32 slot, EQuickTweenState newState)
+{
+	State[slot] = newState;
+	UpdateBucket(slot);
+}
+
+int32 FQuickTweenStorage::FindOrAddTimeChannel(FName name)
+{
+	if (const int32* index = TimeChannelIndices.Find(name))
+	{
+		return *index;
+	}
+
+	// ... the default channel always takes index 0
+	if (TimeChannels.IsEmpty() && !name.IsNone())
+	{
+		FindOrAddTimeChannel(NAME_None);
+	}
+
+	const int32 index = TimeChannels.Add({name});
+	TimeChannelIndices.Add(name, index);
+	return index;
+}
+
+void FQuickTweenStorage::SetTimeChannel(int32 slot, int32 channel)
+{
+	// ... time accumulated so far was played at the previous channel scale
+	FlushAccumulatedDelta(slot);
+	TimeChannel[slot] = channel;
+}
+
+void FQuickTweenStorage::SetTickGroup(int32 slot, EQuickTweenTickGroup group)
+{
+	if (TickGroup[slot] != group)
+	{
+		RemoveFromBucket(slot);
+		TickGroup[slot] = group;
+		AddToBucket(slot, ComputeBucket(slot));
+	}
+}
+
+EQuickTweenBucket FQuickTweenStorage::ComputeBucket(int32 slot) const
+{
+	switch (State[slot])
+	{
+	case EQuickTweenState::Play:
+		return HasFlag(slot, EQuickTweenSlotFlags::PlayWhilePaused) ? EQuickTweenBucket::PlayingWhilePaused : EQuickTweenBucket::Playing;
+	case EQuickTweenState::Pause:
+		return EQuickTweenBucket::Paused;
+	case EQuickTweenState::Complete:
+		return EQuickTweenBucket::Completed;
+	case EQuickTweenState::Kill:
+		return EQuickTweenBucket::Killed;
+	default:
+		return EQuickTweenBucket::Idle;
+	}
+}
+
+void FQuickTweenStorage::UpdateBucket(int32 slot)
+{
+	const EQuickTweenBucket bucket = ComputeBucket(slot);
+	if (bucket != Bucket[slot])
+	{
+		if (bucket != EQuickTweenBucket::Playing && bucket != EQuickTweenBucket::PlayingWhilePaused)
+		{
+			// ... time deferred while playing still counts once the slot stops
+			FlushAccumulatedDelta(slot);
+		}
+
+		RemoveFromBucket(slot);
+		AddToBucket(slot, bucket);
+	}
+}
+
+void FQuickTweenStorage::AddToBucket(int32 slot, EQuickTweenBucket bucket)
+{
+	Bucket[slot] = bucket;
+	BucketIndex[slot] = Buckets[static_cast<int32>(TickGroup[slot])][static_cast<int32>(bucket)].Add(slot);
+}
+
+void FQuickTweenStorage::RemoveFromBucket(int32 slot)
+{
+	TArray<int32>& bucket = Buckets[static_cast<int32>(TickGroup[slot])][static_cast<int32>(Bucket[slot])];
+	const int32 index = BucketIndex[slot];
+	bucket.RemoveAtSwap(index, 1, EAllowShrinking::No);
+
+	// ... the last entry was moved into the freed position
+	if (bucket.IsValidIndex(index))
+	{
+		BucketIndex[bucket[index]] = index;
+	}
+	BucketIndex[slot] = INDEX_NONE;
+}
+
+void FQuickTweenStorage::FlushAccumulatedDelta(int32 slot)
+{
+	const float direction = HasFlag(slot, EQuickTweenSlotFlags::Reversed) ? -1.f : 1.f;
+	if (AccumulatedDelta[slot] != 0.0f)
+	{
+		ElapsedTime[slot] += direction * AccumulatedDelta[slot] * TimeScale[slot]; // ... we allow overflow to handle completion properly
+		AccumulatedDelta[slot] = 0.0f;
+	}
+
+	// ... one addition per step so the result doesn't depend on how the steps were spread over frames
+	const float channelScale = TimeChannels[TimeChannel[slot]].TimeScale;
+	for (; AccumulatedSteps[slot] > 0; --AccumulatedSteps[slot])
+	{
+		ElapsedTime[slot] += direction * FixedStep * channelScale * TimeScale[slot];
+	}
+}
+
+float FQuickTweenStorage::GetRenderTime(int32 slot) const
+{
+	if (RenderLag <= 0.0f)
+	{
+		return ElapsedTime[slot];
+	}
+
+	const float direction = HasFlag(slot, EQuickTweenSlotFlags::Reversed) ? -1.f : 1.f;
+	const float endTime = Loops[slot] == INFINITE_LOOPS ? TNumericLimits<float>::Max() : Duration[slot] * Loops[slot];
+	return FMath::Clamp(ElapsedTime[slot] - direction * RenderLag * TimeScale[slot], 0.0f, endTime);
+}
+
+void FQuickTweenStorage::Advance(float deltaTime, int32 numFixedSteps, uint64 frame, bool bIsWorldPaused, EQuickTweenTickGroup group, FQuickTweenAdvanceBudget& budget, TArray<UQuickTweenBase*>& outAdvanced, TArray<int32>& outAdvancedSlots)
+{
+	outAdvanced.Reset();
+	outAdvancedSlots.Reset();
+	budget.NumDeferred = 0;
+	budget.MaxDeferredTime = 0.0f;
+
+	// ... channel factors are applied once per channel, slots only look their delta up
+	ChannelDeltas.SetNumUninitialized(TimeChannels.Num());
+	for (int32 channel = 0; channel < TimeChannels.Num(); ++channel)
+	{
+		ChannelDeltas[channel] = deltaTime * TimeChannels[channel].TimeScale;
+	}
+
+	auto advanceSlot = [&](int32 slot)
+	{
+		FlushAccumulatedDelta(slot);
+		outAdvanced.Add(Tweens[slot]);
+		outAdvancedSlots.Add(slot);
+	};
+
+	// ... idle, paused, completed and killed slots are never visited
+	auto gatherBucket = [&](EQuickTweenBucket bucket)
+	{
+		for (const int32 slot : GetBucket(bucket, group))
+		{
+			const int32 channel = TimeChannel[slot];
+			if (TimeChannels[channel].bIsPaused)
+			{
+				continue;
+			}
+
+			if (FixedStep > 0.0f)
+			{
+				AccumulatedSteps[slot] += numFixedSteps;
+			}
+			else
+			{
+				AccumulatedDelta[slot] += ChannelDeltas[channel];
+			}
+
+			if (UpdateInterval[slot] > 1 && (frame + UpdatePhase[slot]) % UpdateInterval[slot] != 0)
+			{
+				continue;
+			}
+
+			if (budget.MaxAdvanced == INDEX_NONE || Priority[slot] == EQuickTweenPriority::Critical)
+			{
+				advanceSlot(slot);
+			}
+			else
+			{
+				BudgetCandidates[static_cast<int32>(Priority[slot])].Add(slot);
+			}
+		}
+	};
+
+	gatherBucket(EQuickTweenBucket::PlayingWhilePaused);
+	if (!bIsWorldPaused)
+	{
+		gatherBucket(EQuickTweenBucket::Playing);
+	}
+
+	// ... lower classes share what the critical slots left, round-robin so every slot gets its turn
+	int32 remaining = FMath::Max(0, budget.MaxAdvanced - outAdvanced.Num());
+	for (int32 priority = static_cast<int32>(EQuickTweenPriority::Normal); priority < static_cast<int32>(EQuickTweenPriority::Num); ++priority)
+	{
+		TArray<int32>& candidates = BudgetCandidates[priority];
+		if (candidates.IsEmpty())
+		{
+			continue;
+		}
+
+		int32& cursor = RoundRobinCursor[static_cast<int32>(group)][priority];
+		const int32 start = cursor % candidates.Num();
+		const int32 numToAdvance = FMath::Min(remaining, candidates.Num());
+		for (int32 i = 0; i < candidates.Num(); ++i)
+		{
+			const int32 slot = candidates[(start + i) % candidates.Num()];
+			if (i < numToAdvance)
+			{
+				advanceSlot(slot);
+			}
+			else
+			{
+				++budget.NumDeferred;
+
+				// ... fixed step mode accumulates steps instead of delta, the channel scale is applied on flush
+				const float deferredSteps = AccumulatedSteps[slot] * FixedStep * TimeChannels[TimeChannel[slot]].TimeScale;
+				budget.MaxDeferredTime = FMath::Max(budget.MaxDeferredTime, AccumulatedDelta[slot] + deferredSteps);
+			}
+		}
+
+		cursor = start + numToAdvance;
+		remaining -= numToAdvance;
+		candidates.Reset();
+	}
+}
+
+void FQuickTweenStorage::Compute(int32 slot, FQuickTweenComputedState& outComputed) const
+{
+	FQuickTweenComputeInput input;
+	GatherComputeInput(slot, input);
+	Compute(input, outComputed);
+}
+
+void FQuickTweenStorage::GatherComputeInput(int32 slot, FQuickTweenComputeInput& outInput) const
+{
+	outInput.ElapsedTime = ElapsedTime[slot];
+	outInput.RenderTime = GetRenderTime(slot);
+	outInput.Duration = Duration[slot];
+	outInput.LoopType = LoopType[slot];
+	outInput.EaseType = EaseType[slot];
+	outInput.EaseCurve = EaseCurve[slot];
+	outInput.bShouldCompute = HasFlag(slot, EQuickTweenSlotFlags::ParallelCompute);
+}
+
+void FQuickTweenStorage::Compute(const FQuickTweenComputeInput& input, FQuickTweenComputedState& outComputed)
+{
+	outComputed.ElapsedTime = input.ElapsedTime;
+	outComputed.State = FQuickTweenTiming::ComputeState(input.ElapsedTime, input.Duration, input.LoopType);
+	const float alpha = input.RenderTime != input.ElapsedTime ? FQuickTweenTiming::ComputeState(input.RenderTime, input.Duration, input.LoopType).Alpha : outComputed.State.Alpha;
+	outComputed.EasedAlpha = FQuickTweenTiming::EaseAlpha(alpha, input.EaseType, input.EaseCurve);
+	outComputed.bIsComputed = true;
+}
@@ -0,0 +1,69 @@
+﻿// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+
+#include "QuickTweenTrace.h"
+
+#if QUICKTWEEN_TRACE_ENABLED
+
+#include "QuickTweenable.h"
+#include "Engine/World.h"
+
+UE_TRACE_CHANNEL_DEFINE(QuickTweenChannel);
+
+UE_TRACE_EVENT_BEGIN(QuickTween, TweenLifecycle)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint64, TweenId)
+	UE_TRACE_EVENT_FIELD(uint8, Event)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Tag)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Class)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, World)
+UE_TRACE_EVENT_END()
+
+void FQuickTweenTrace::OutputLifecycleEvent(const UQuickTweenable* tween, EQuickTweenTraceEvent event)
+{
+	if (!tween)
+	{
+		return;
+	}
+
+	const FString tag = tween->GetTweenTag();
+	const FString className = tween->GetClass()->GetName();
+	const UWorld* world = tween->GetWorld();
+	const FString worldName = world ? world->GetName() : FString();
+
+	UE_TRACE_LOG(QuickTween, TweenLifecycle, QuickTweenChannel)
+		<< TweenLifecycle.Cycle(FPlatformTime::Cycles64())
+		<< TweenLifecycle.TweenId(static_cast<uint64>(reinterpret_cast<UPTRINT>(tween)))
+		<< TweenLifecycle.Event(static_cast<uint8>(event))
+		<< TweenLifecycle.Tag(*tag, tag.Len())
+		<< TweenLifecycle.Class(*className, className.Len())
+		<< TweenLifecycle.World(*worldName, worldName.Len());
+}
+
+void FQuickTweenTrace::OutputStateTransition(const UQuickTweenable* tween, EQuickTweenState newState)
+{
+	switch (newState)
+	{
+	case EQuickTweenState::Play:
+		OutputLifecycleEvent(tween, EQuickTweenTraceEvent::Play);
+		break;
+	case EQuickTweenState::Pause:
+		OutputLifecycleEvent(tween, EQuickTweenTraceEvent::Pause);
+		break;
+	case EQuickTweenState::Complete:
+		OutputLifecycleEvent(tween, EQuickTweenTraceEvent::Complete);
+		break;
+	case EQuickTweenState::Kill:
+		OutputLifecycleEvent(tween, EQuickTweenTraceEvent::Kill);
+		break;
+	default:
+		break;
+	}
+}
+
+FString FQuickTweenTrace::GetSetterScopeName(const UQuickTweenable* tween)
+{
+	const FName tag = tween->GetTweenTagName();
+	return tag.IsNone() ? tween->GetClass()->GetName() : tag.ToString();
+}
+
+#endif
@@ -0,0 +1,65 @@
+﻿// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Utils/CommonValues.h"
+
+/**
+ * Insights trace of the tween module, recorded on the QuickTween channel ("-trace=cpu,quicktween").
+ * Define QUICKTWEEN_TRACE_ENABLED to 0 to compile every macro below out, shipping builds do by default.
+ */
+#ifndef QUICKTWEEN_TRACE_ENABLED
+#define QUICKTWEEN_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+#endif
+
+#if QUICKTWEEN_TRACE_ENABLED
+
+class UQuickTweenable;
+
+UE_TRACE_CHANNEL_EXTERN(QuickTweenChannel);
+
+enum class EQuickTweenTraceEvent : uint8
+{
+	Create,
+	Play,
+	Pause,
+	Complete,
+	Kill
+};
+
+struct FQuickTweenTrace
+{
+	/** Record a lifecycle event of the tween with its tag, class and owning world. */
+	static void OutputLifecycleEvent(const UQuickTweenable* tween, EQuickTweenTraceEvent event);
+
+	/** Record the state a tween transitioned to, returning to idle is not recorded. */
+	static void OutputStateTransition(const UQuickTweenable* tween, EQuickTweenState newState);
+
+	/** Name of the timing scope around the tween's setter, its tag or its class without one. */
+	[[nodiscard]] static FString GetSetterScopeName(const UQuickTweenable* tween);
+};
+
+#define QUICKTWEEN_TRACE_LIFECYCLE(tween, event) \
+	do { if (UE_TRACE_CHANNELEXPR_IS_ENABLED(QuickTweenChannel)) { FQuickTweenTrace::OutputLifecycleEvent(tween, EQuickTweenTraceEvent::event); } } while (0)
+
+#define QUICKTWEEN_TRACE_STATE(tween, newState) \
+	do { if (UE_TRACE_CHANNELEXPR_IS_ENABLED(QuickTweenChannel)) { FQuickTweenTrace::OutputStateTransition(tween, newState); } } while (0)
+
+#define QUICKTWEEN_TRACE_SCOPE(name) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(name, QuickTweenChannel)
+
+// ... the name is only built while the channel is on
+#define QUICKTWEEN_TRACE_SETTER_SCOPE(tween) \
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(UE_TRACE_CHANNELEXPR_IS_ENABLED(QuickTweenChannel) ? *FQuickTweenTrace::GetSetterScopeName(tween) : TEXT(""), QuickTweenChannel)
+
+#else
+
+#define QUICKTWEEN_TRACE_LIFECYCLE(tween, event)
+#define QUICKTWEEN_TRACE_STATE(tween, newState)
+#define QUICKTWEEN_TRACE_SCOPE(name)
+#define QUICKTWEEN_TRACE_SETTER_SCOPE(tween)
+
+#endif
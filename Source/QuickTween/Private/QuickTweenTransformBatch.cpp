@@ -0,0 +1,130 @@
+﻿// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+
+#include "QuickTweenTransformBatch.h"
+#include "Components/SceneComponent.h"
+
+void FQuickTweenTransformBatch::Flush()
+{
+	bIsBatching = false;
+
+	for (const FQuickTweenPendingTransform& pending : Pending)
+	{
+		Write(pending);
+	}
+	Pending.Reset();
+	PendingIndices.Reset();
+}
+
+void FQuickTweenTransformBatch::SetLocation(USceneComponent* component, const FVector& location, EQuickTweenSpace space, bool bSweep, ETeleportType teleport)
+{
+	FQuickTweenPendingTransform pending;
+	FQuickTweenPendingTransform& entry = bIsBatching ? FindOrAdd(component) : pending;
+	entry.Component = component;
+	entry.Location = location;
+	entry.LocationSpace = space;
+	entry.bSweep = bSweep;
+	entry.Teleport = teleport;
+
+	if (!bIsBatching)
+	{
+		Write(entry);
+	}
+}
+
+void FQuickTweenTransformBatch::SetRotation(USceneComponent* component, const FRotator& rotation, EQuickTweenSpace space)
+{
+	FQuickTweenPendingTransform pending;
+	FQuickTweenPendingTransform& entry = bIsBatching ? FindOrAdd(component) : pending;
+	entry.Component = component;
+	entry.Rotation = rotation;
+	entry.RotationSpace = space;
+
+	if (!bIsBatching)
+	{
+		Write(entry);
+	}
+}
+
+void FQuickTweenTransformBatch::SetScale(USceneComponent* component, const FVector& scale, EQuickTweenSpace space)
+{
+	FQuickTweenPendingTransform pending;
+	FQuickTweenPendingTransform& entry = bIsBatching ? FindOrAdd(component) : pending;
+	entry.Component = component;
+	entry.Scale = scale;
+	entry.ScaleSpace = space;
+
+	if (!bIsBatching)
+	{
+		Write(entry);
+	}
+}
+
+FQuickTweenPendingTransform& FQuickTweenTransformBatch::FindOrAdd(USceneComponent* component)
+{
+	if (const int32* index = PendingIndices.Find(component))
+	{
+		return Pending[*index];
+	}
+
+	const int32 index = Pending.AddDefaulted();
+	PendingIndices.Add(component, index);
+	return Pending[index];
+}
+
+void FQuickTweenTransformBatch::Write(const FQuickTweenPendingTransform& pending)
+{
+	USceneComponent* component = pending.Component.Get();
+	if (!component)
+	{
+		return;
+	}
+
+	const int32 numParts = pending.Location.IsSet() + pending.Rotation.IsSet() + pending.Scale.IsSet();
+	const EQuickTweenSpace space = pending.Location.IsSet() ? pending.LocationSpace : pending.Rotation.IsSet() ? pending.RotationSpace : pending.ScaleSpace;
+	const bool bSameSpace =
+		(!pending.Location.IsSet() || pending.LocationSpace == space) &&
+		(!pending.Rotation.IsSet() || pending.RotationSpace == space) &&
+		(!pending.Scale.IsSet() || pending.ScaleSpace == space);
+
+	// ... several parts in one space, a single transform update
+	if (numParts > 1 && bSameSpace)
+	{
+		FTransform transform = space == EQuickTweenSpace::WorldSpace ? component->GetComponentTransform() : component->GetRelativeTransform();
+		if (pending.Location.IsSet())
+		{
+			transform.SetLocation(pending.Location.GetValue());
+		}
+		if (pending.Rotation.IsSet())
+		{
+			transform.SetRotation(pending.Rotation.GetValue().Quaternion());
+		}
+		if (pending.Scale.IsSet())
+		{
+			transform.SetScale3D(pending.Scale.GetValue());
+		}
+
+		space == EQuickTweenSpace::WorldSpace ?
+			component->SetWorldTransform(transform, pending.bSweep, nullptr, pending.Teleport) :
+			component->SetRelativeTransform(transform, pending.bSweep, nullptr, pending.Teleport);
+		return;
+	}
+
+	if (pending.Location.IsSet())
+	{
+		pending.LocationSpace == EQuickTweenSpace::WorldSpace ?
+			component->SetWorldLocation(pending.Location.GetValue(), pending.bSweep, nullptr, pending.Teleport) :
+			component->SetRelativeLocation(pending.Location.GetValue(), pending.bSweep, nullptr, pending.Teleport);
+	}
+	if (pending.Rotation.IsSet())
+	{
+		pending.RotationSpace == EQuickTweenSpace::WorldSpace ?
+			component->SetWorldRotation(pending.Rotation.GetValue()) :
+			component->SetRelativeRotation(pending.Rotation.GetValue());
+	}
+	if (pending.Scale.IsSet())
+	{
+		pending.ScaleSpace == EQuickTweenSpace::WorldSpace ?
+			component->SetWorldScale3D(pending.Scale.GetValue()) :
+			component->SetRelativeScale3D(pending.Scale.GetValue());
+	}
+}
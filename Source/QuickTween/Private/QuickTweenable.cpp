@@ -2,6 +2,7 @@
 
 
 #include "QuickTweenable.h"
+#include "QuickTweenGroup.h"
 
 
 // Add default functionality here for any IQuickTweenable functions that are not pure virtual.
@@ -27,11 +28,22 @@ bool UQuickTweenable::GetIsCompleted() const
 	return false;
 }
 
+void UQuickTweenable::ResetForReuse()
+{
+	ensureAlwaysMsgf(false, TEXT("ResetForReuse not implemented in IQuickTweenable"));
+}
+
 void UQuickTweenable::SetOwner(UQuickTweenable* owner)
 {
 	ensureAlwaysMsgf(false, TEXT("SetOwner not implemented in IQuickTweenable"));
 }
 
+UQuickTweenable* UQuickTweenable::GetOwner() const
+{
+	ensureAlwaysMsgf(false, TEXT("GetOwner not implemented in IQuickTweenable"));
+	return nullptr;
+}
+
 void UQuickTweenable::Play()
 {
 	ensureAlwaysMsgf(false, TEXT("Play not implemented in IQuickTweenable"));
@@ -121,6 +133,12 @@ FString UQuickTweenable::GetTweenTag() const
 	return FString();
 }
 
+FName UQuickTweenable::GetTweenTagName() const
+{
+	ensureAlwaysMsgf(false, TEXT("GetTweenTagName not implemented in IQuickTweenable"));
+	return NAME_None;
+}
+
 int32 UQuickTweenable::GetCurrentLoop() const
 {
 	ensureAlwaysMsgf(false, TEXT("GetCurrentLoop not implemented in IQuickTweenable"));
@@ -139,6 +157,11 @@ bool UQuickTweenable::GetIsPendingKill() const
 	return false;
 }
 
+UQuickTweenGroup* UQuickTweenable::GetTweenGroup() const
+{
+	return Group.Get();
+}
+
 bool UQuickTweenable::GetShouldPlayWhilePaused() const
 {
 	ensureAlwaysMsgf(false, TEXT("GetShouldPlayWhilePaused not implemented in IQuickTweenable"));
@@ -5,13 +5,11 @@
 #include "Curves/CurveFloat.h"
 #include "Utils/EaseFunctions.h"
 
-void UQuickColorTween::ApplyAlphaValue(float alpha)
+void UQuickColorTween::ApplyEasedAlphaValue(float easedAlpha)
 {
 	const FColor startValue = StartValue.Get(FColor::White);
 	const FColor endValue = EndValue.Get(FColor::White);
-	FLinearColor value =  GetEaseCurve() ?
-		FEaseFunctions<FLinearColor>::Ease(FLinearColor(startValue), FLinearColor(endValue), alpha, GetEaseCurve()):
-		FEaseFunctions<FLinearColor>::Ease(FLinearColor(startValue), FLinearColor(endValue), alpha, GetEaseType());
+	const FLinearColor value = TEaseLerp<FLinearColor>::Lerp(FLinearColor(startValue), FLinearColor(endValue), easedAlpha, EEasePath::Default);
 
 	if (Setter.IsBound())
 	{
@@ -55,7 +53,7 @@ void UQuickColorTween::HandleOnComplete()
 
 	bool bSnapToBeginning = !bSnapToEnd || (GetLoopType() == ELoopType::PingPong && GetLoops() % 2 == 0);
 	const FColor value = bSnapToBeginning ? StartValue.Get(FColor::White) : EndValue.Get(FColor::White);
-	if (Setter.IsBound())
+	if (Setter.IsBound() && !GetHasYieldedProperty())
 	{
 		Setter.Execute(value, this);
 	}
@@ -63,3 +61,15 @@ void UQuickColorTween::HandleOnComplete()
 
 	Super::HandleOnComplete();
 }
+
+void UQuickColorTween::ResetForReuse()
+{
+	From.Unbind();
+	To.Unbind();
+	Setter.Unbind();
+	StartValue.Reset();
+	EndValue.Reset();
+	CurrentValue = FColor(ForceInit);
+
+	Super::ResetForReuse();
+}
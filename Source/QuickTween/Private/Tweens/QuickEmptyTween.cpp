@@ -4,7 +4,7 @@
 #include "Tweens/QuickEmptyTween.h"
 #include "Curves/CurveFloat.h"
 
-void UQuickEmptyTween::ApplyAlphaValue(float alpha)
+void UQuickEmptyTween::ApplyEasedAlphaValue(float easedAlpha)
 {
 	// Empty tween does not apply any value.
 }
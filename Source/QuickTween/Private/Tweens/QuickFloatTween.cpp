@@ -5,11 +5,9 @@
 #include "Curves/CurveFloat.h"
 #include "Utils/EaseFunctions.h"
 
-void UQuickFloatTween::ApplyAlphaValue(float alpha)
+void UQuickFloatTween::ApplyEasedAlphaValue(float easedAlpha)
 {
-	const float value = GetEaseCurve() ?
-	FEaseFunctions<float>::Ease(StartValue.Get(0.0f), EndValue.Get(0.0f), alpha, GetEaseCurve()) :
-	FEaseFunctions<float>::Ease(StartValue.Get(0.0f), EndValue.Get(0.0f), alpha, GetEaseType());
+	const float value = TEaseLerp<float>::Lerp(StartValue.Get(0.0f), EndValue.Get(0.0f), easedAlpha, EEasePath::Default);
 	if (Setter.IsBound())
 	{
 		Setter.Execute(value, this);
@@ -55,7 +53,7 @@ void UQuickFloatTween::HandleOnComplete()
 
 	bool bSnapToBeginning = !bSnapToEnd || (GetLoopType() == ELoopType::PingPong && GetLoops() % 2 == 0);
 	const float value = bSnapToBeginning ? StartValue.Get(0.0f) : EndValue.Get(0.0f);
-	if (Setter.IsBound())
+	if (Setter.IsBound() && !GetHasYieldedProperty())
 	{
 		Setter.Execute(value, this);
 	}
@@ -63,3 +61,15 @@ void UQuickFloatTween::HandleOnComplete()
 
 	Super::HandleOnComplete();
 }
+
+void UQuickFloatTween::ResetForReuse()
+{
+	From.Unbind();
+	To.Unbind();
+	Setter.Unbind();
+	StartValue.Reset();
+	EndValue.Reset();
+	CurrentValue = 0.0f;
+
+	Super::ResetForReuse();
+}
@@ -5,11 +5,9 @@
 #include "Curves/CurveFloat.h"
 #include "Utils/EaseFunctions.h"
 
-void UQuickIntTween::ApplyAlphaValue(float alpha)
+void UQuickIntTween::ApplyEasedAlphaValue(float easedAlpha)
 {
-	const int32 value = GetEaseCurve() ?
-	FEaseFunctions<int32>::Ease(StartValue.Get(0), EndValue.Get(0), alpha, GetEaseCurve()) :
-	FEaseFunctions<int32>::Ease(StartValue.Get(0), EndValue.Get(0), alpha, GetEaseType());
+	const int32 value = TEaseLerp<int32>::Lerp(StartValue.Get(0), EndValue.Get(0), easedAlpha, EEasePath::Default);
 	if (Setter.IsBound())
 	{
 		Setter.Execute(value, this);
@@ -55,7 +53,7 @@ void UQuickIntTween::HandleOnComplete()
 
 	bool bSnapToBeginning = !bSnapToEnd || (GetLoopType() == ELoopType::PingPong && GetLoops() % 2 == 0);
 	const int32 value = bSnapToBeginning ? StartValue.Get(0) : EndValue.Get(0);
-	if (Setter.IsBound())
+	if (Setter.IsBound() && !GetHasYieldedProperty())
 	{
 		Setter.Execute(value, this);
 	}
@@ -64,3 +62,15 @@ void UQuickIntTween::HandleOnComplete()
 
 	Super::HandleOnComplete();
 }
+
+void UQuickIntTween::ResetForReuse()
+{
+	From.Unbind();
+	To.Unbind();
+	Setter.Unbind();
+	StartValue.Reset();
+	EndValue.Reset();
+	CurrentValue = 0;
+
+	Super::ResetForReuse();
+}
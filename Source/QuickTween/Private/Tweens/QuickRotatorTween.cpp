@@ -5,12 +5,10 @@
 #include "Curves/CurveFloat.h"
 #include "Utils/EaseFunctions.h"
 
-void UQuickRotatorTween::ApplyAlphaValue(float alpha)
+void UQuickRotatorTween::ApplyEasedAlphaValue(float easedAlpha)
 {
 	EEasePath path = bShortestPath ? EEasePath::Shortest : EEasePath::Longest;
-	const FRotator value = GetEaseCurve() ?
-	FEaseFunctions<FRotator>::Ease(StartValue.Get(FRotator::ZeroRotator), EndValue.Get(FRotator::ZeroRotator), alpha, GetEaseCurve(), path) :
-	FEaseFunctions<FRotator>::Ease(StartValue.Get(FRotator::ZeroRotator), EndValue.Get(FRotator::ZeroRotator), alpha, GetEaseType(), path);
+	const FRotator value = TEaseLerp<FRotator>::Lerp(StartValue.Get(FRotator::ZeroRotator), EndValue.Get(FRotator::ZeroRotator), easedAlpha, path);
 
 	if (Setter.IsBound())
 	{
@@ -57,7 +55,7 @@ void UQuickRotatorTween::HandleOnComplete()
 
 	bool bSnapToBeginning = !bSnapToEnd || (GetLoopType() == ELoopType::PingPong && GetLoops() % 2 == 0);
 	FRotator value = bSnapToBeginning ? StartValue.Get(FRotator::ZeroRotator) : EndValue.Get(FRotator::ZeroRotator);
-	if (Setter.IsBound())
+	if (Setter.IsBound() && !GetHasYieldedProperty())
 	{
 		Setter.Execute(value, this);
 	}
@@ -65,3 +63,16 @@ void UQuickRotatorTween::HandleOnComplete()
 
 	Super::HandleOnComplete();
 }
+
+void UQuickRotatorTween::ResetForReuse()
+{
+	From.Unbind();
+	To.Unbind();
+	Setter.Unbind();
+	StartValue.Reset();
+	EndValue.Reset();
+	bShortestPath = true;
+	CurrentValue = FRotator::ZeroRotator;
+
+	Super::ResetForReuse();
+}
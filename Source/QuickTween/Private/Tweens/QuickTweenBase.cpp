@@ -2,7 +2,14 @@
 #include "Tweens/QuickTweenBase.h"
 
 #include "QuickTweenManager.h"
+#include "QuickTweenStats.h"
+#include "QuickTweenTrace.h"
 #include "Utils/CommonValues.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Actor.h"
+
+/** Seconds since the last render a culled tween's target still counts as visible. */
+static constexpr float CullRenderTolerance = 0.2f;
 
 UQuickTweenBase::~UQuickTweenBase()
 {
@@ -11,7 +18,7 @@ UQuickTweenBase::~UQuickTweenBase()
 		return;
 	}
 
-	if (UQuickTweenManager* manager = UQuickTweenManager::Get(WorldContextObject))
+	if (UQuickTweenManager* manager = Manager.Get())
 	{
 		manager->RemoveTween(this);
 	}
@@ -28,7 +35,8 @@ void UQuickTweenBase::SetUp(
 	const FString& tweenTag,
 	bool bShouldAutoKill,
 	bool bShouldPlayWhilePaused,
-	bool bShouldAutoPlay)
+	bool bShouldAutoPlay,
+	FName timeChannel)
 {
 	WorldContextObject = worldContextObject;
 	Duration = duration;
@@ -37,9 +45,10 @@ void UQuickTweenBase::SetUp(
 	EaseCurve = easeCurve;
 	Loops = loops;
 	LoopType = loopType;
-	TweenTag = tweenTag;
+	TweenTag = tweenTag.IsEmpty() ? NAME_None : FName(*tweenTag);
 	bAutoKill = bShouldAutoKill;
 	bPlayWhilePaused = bShouldPlayWhilePaused;
+	TimeChannel = timeChannel;
 
 	if (!ensureAlwaysMsgf(Duration > 0.f, TEXT("UQuickTweenBase::SetUp: Duration must be greater than zero, default to one.")))
 	{
@@ -47,6 +56,7 @@ void UQuickTweenBase::SetUp(
 	}
 
 	UQuickTweenManager* manager = UQuickTweenManager::Get(WorldContextObject);
+	Manager = manager;
 	if (!manager)
 	{
 		UE_LOG(LogQuickTweenBase, Log, TEXT("Failed to get QuickTweenManager for QuickTweenBase. Tweens will not be updated."));
@@ -66,28 +76,56 @@ void UQuickTweenBase::Update(float deltaTime)
 {
 	if (HasOwner()) return;
 
-	ElapsedTime += (bIsReversed ? -1.f : 1.f) * deltaTime * GetTimeScale(); // ... we allow overflow to handle completion properly
+	SetElapsedTime(GetElapsedTime() + (GetIsReversed() ? -1.f : 1.f) * deltaTime * GetTimeScale()); // ... we allow overflow to handle completion properly
+
+	UpdateFromElapsedTime();
+}
 
-	FQuickTweenStateResult state = ComputeTweenState(ElapsedTime);
+void UQuickTweenBase::UpdateFromElapsedTime()
+{
+	// ... fixed step interpolation: loops and completion follow the simulated time, the value is rendered behind it
+	if (IsInStorage() && Storage->RenderLag > 0.0f)
+	{
+		ResolveUpdate(ComputeTweenState(GetElapsedTime()), EaseAlpha(ComputeTweenState(Storage->GetRenderTime(StorageSlot)).Alpha));
+		return;
+	}
 
-	const int32 numLoopsCrossed = FMath::Abs(state.Loop - CurrentLoop);
+	ResolveUpdate(ComputeTweenState(GetElapsedTime()), TOptional<float>());
+}
+
+void UQuickTweenBase::UpdateFromComputedState(const FQuickTweenComputedState& computed)
+{
+	if (!computed.bIsComputed || computed.ElapsedTime != GetElapsedTime())
+	{
+		UpdateFromElapsedTime();
+		return;
+	}
+
+	ResolveUpdate(computed.State, computed.EasedAlpha);
+}
+
+void UQuickTweenBase::ResolveUpdate(const FQuickTweenStateResult& state, TOptional<float> easedAlpha)
+{
+	const int32 numLoopsCrossed = FMath::Abs(state.Loop - GetCurrentLoop());
 	if (bTriggerEvents && OnLoop.IsBound())
 	{
+		SCOPE_CYCLE_COUNTER(STAT_QuickTween_Events);
 		for (int32 i = 0; i < numLoopsCrossed; ++i)
 		{
 			OnLoop.Broadcast(this);
 		}
 	}
-	CurrentLoop = state.Loop;
+	SetCurrentLoop(state.Loop);
 
 	// ... check for completion
 	if (Loops != INFINITE_LOOPS)
 	{
-		if ((!bIsReversed && CurrentLoop >= Loops) || (bIsReversed && ElapsedTime < 0.0f))
+		const bool bReversed = GetIsReversed();
+		if ((!bReversed && GetCurrentLoop() >= Loops) || (bReversed && GetElapsedTime() < 0.0f))
 		{
 			if (RequestStateTransition(EQuickTweenState::Complete))
 			{
-				HandleOnComplete();
+				ApplyCompletion();
 				if (bAutoKill && RequestStateTransition(EQuickTweenState::Kill))
 				{
 					HandleOnKill();
@@ -97,10 +135,24 @@ void UQuickTweenBase::Update(float deltaTime)
 		}
 	}
 
-	ApplyAlphaValue(state.Alpha);
+	// ... offscreen and yielded tweens keep their timing, the first visible update writes the current value
+	if (ShouldWriteValue())
+	{
+		if (easedAlpha.IsSet())
+		{
+			SCOPE_CYCLE_COUNTER(STAT_QuickTween_Setters);
+			QUICKTWEEN_TRACE_SETTER_SCOPE(this);
+			ApplyEasedAlphaValue(easedAlpha.GetValue());
+		}
+		else
+		{
+			ApplyAlphaValue(state.Alpha);
+		}
+	}
 
 	if (bTriggerEvents && OnUpdate.IsBound())
 	{
+		SCOPE_CYCLE_COUNTER(STAT_QuickTween_Events);
 		OnUpdate.Broadcast(this);
 	}
 }
@@ -109,25 +161,25 @@ void UQuickTweenBase::Evaluate(const FQuickTweenEvaluatePayload& payload, const
 {
 	if (!HasOwner() || !InstigatorIsOwner(instigator)) return;
 
-	bIsReversed = payload.bIsReversed;
+	SetIsReversed(payload.bIsReversed);
 	bTriggerEvents = payload.bShouldTriggerEvents;
-	ElapsedTime = FMath::Clamp(payload.Value * GetTotalDuration(), 0.f, GetTotalDuration());
+	SetElapsedTime(FMath::Clamp(payload.Value * GetTotalDuration(), 0.f, GetTotalDuration()));
 
 	if (bWasActive != payload.bIsActive)
 	{
 		auto simulateOnStart = [&]()
 		{
-			CurrentLoop = bIsReversed ? GetLoops() - 1 : 0;
+			SetCurrentLoop(GetIsReversed() ? GetLoops() - 1 : 0);
 			HandleOnStart();
 		};
 
 		auto shouldSimulateOnComplete = [&]()
 		{
-			if ((bIsReversed && FMath::IsNearlyZero(ElapsedTime)) ||
-			    (!bIsReversed && FMath::IsNearlyEqual(ElapsedTime, GetTotalDuration())))
+			if ((GetIsReversed() && FMath::IsNearlyZero(GetElapsedTime())) ||
+			    (!GetIsReversed() && FMath::IsNearlyEqual(GetElapsedTime(), GetTotalDuration())))
 			{
-				CurrentLoop = bIsReversed ? 0 : GetLoops() - 1;
-				HandleOnComplete();
+				SetCurrentLoop(GetIsReversed() ? 0 : GetLoops() - 1);
+				ApplyCompletion();
 			}
 		};
 
@@ -147,71 +199,187 @@ void UQuickTweenBase::Evaluate(const FQuickTweenEvaluatePayload& payload, const
 		return;
 	}
 
-	FQuickTweenStateResult state = ComputeTweenState(ElapsedTime);
+	FQuickTweenStateResult state = ComputeTweenState(GetElapsedTime());
 
-	const int32 numLoopsCrossed = FMath::Abs(state.Loop - CurrentLoop);
+	const int32 numLoopsCrossed = FMath::Abs(state.Loop - GetCurrentLoop());
 	if (bTriggerEvents && OnLoop.IsBound())
 	{
+		SCOPE_CYCLE_COUNTER(STAT_QuickTween_Events);
 		for (int32 i = 0; i < numLoopsCrossed; ++i)
 		{
 			OnLoop.Broadcast(this);
 		}
 	}
-	CurrentLoop = state.Loop;
+	SetCurrentLoop(state.Loop);
 
-	ApplyAlphaValue(state.Alpha);
+	if (!GetHasYieldedProperty())
+	{
+		ApplyAlphaValue(state.Alpha);
+	}
 
 	if (bTriggerEvents && OnUpdate.IsBound())
 	{
+		SCOPE_CYCLE_COUNTER(STAT_QuickTween_Events);
 		OnUpdate.Broadcast(this);
 	}
 }
 
-UQuickTweenBase::FQuickTweenStateResult UQuickTweenBase::ComputeTweenState(float time) const
+bool UQuickTweenBase::IsCulled() const
+{
+	const USceneComponent* target = bCullWhenNotRendered ? SignificanceSource.Get() : nullptr;
+	if (!target)
+	{
+		return false;
+	}
+
+	if (const UPrimitiveComponent* primitive = Cast<UPrimitiveComponent>(target))
+	{
+		return !primitive->WasRecentlyRendered(CullRenderTolerance);
+	}
+
+	const AActor* owner = target->GetOwner();
+	return owner && !owner->WasRecentlyRendered(CullRenderTolerance);
+}
+
+FQuickTweenStateResult UQuickTweenBase::ComputeTweenState(float time) const
+{
+	return FQuickTweenTiming::ComputeState(time, GetLoopDuration(), GetLoopType());
+}
+
+void UQuickTweenBase::ApplyAlphaValue(float alpha)
+{
+	float easedAlpha;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_QuickTween_Ease);
+		easedAlpha = EaseAlpha(alpha);
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_QuickTween_Setters);
+	QUICKTWEEN_TRACE_SETTER_SCOPE(this);
+	ApplyEasedAlphaValue(easedAlpha);
+}
+
+void UQuickTweenBase::ApplyEasedAlphaValue(float easedAlpha)
+{
+	ensureAlwaysMsgf(false, TEXT("UQuickTweenBase::ApplyEasedAlphaValue: This method should be overridden in derived classes."));
+}
+
+void UQuickTweenBase::SetComputeInParallel(bool bEnable)
+{
+	bComputeInParallel = bEnable;
+	if (IsInStorage())
+	{
+		Storage->SetFlag(StorageSlot, EQuickTweenSlotFlags::ParallelCompute, bEnable);
+	}
+}
+
+void UQuickTweenBase::SetTickGroup(EQuickTweenTickGroup group)
 {
-	FQuickTweenStateResult result;
+	if (!ensureAlwaysMsgf(group != EQuickTweenTickGroup::Num, TEXT("UQuickTweenBase::SetTickGroup: Invalid tick group.")))
+	{
+		return;
+	}
 
-	result.Loop  = FMath::FloorToInt(time /GetLoopDuration());
+	TickGroup = group;
+	if (IsInStorage())
+	{
+		Storage->SetTickGroup(StorageSlot, group);
+	}
 
+	if (UQuickTweenManager* manager = Manager.Get())
+	{
+		manager->EnsureTickFunction(group);
+	}
+}
 
-	float localTime = FMath::Fmod(time, GetLoopDuration());
+void UQuickTweenBase::SetPriority(EQuickTweenPriority priority)
+{
+	if (!ensureAlwaysMsgf(priority != EQuickTweenPriority::Num, TEXT("UQuickTweenBase::SetPriority: Invalid priority.")))
+	{
+		return;
+	}
 
-	if (result.Loop != 0 && FMath::IsNearlyZero(localTime))
+	Priority = priority;
+	if (IsInStorage())
 	{
-		localTime  = GetLoopDuration();
+		Storage->SetPriority(StorageSlot, priority);
 	}
+}
 
-	if (localTime < 0.f)
+void UQuickTweenBase::SetTimeChannel(FName channel)
+{
+	TimeChannel = channel;
+	if (IsInStorage())
 	{
-		localTime += GetLoopDuration();
+		Storage->SetTimeChannel(StorageSlot, Storage->FindOrAddTimeChannel(channel));
 	}
+}
 
-	result.Alpha = localTime / GetLoopDuration();
-	if (GetLoopType() == ELoopType::PingPong && (result.Loop & 1) != 0) // ... odd loop, backward traversal
+void UQuickTweenBase::SetTimeScale(float timeScale)
+{
+	if (!ensureAlwaysMsgf(timeScale > 0.0f, TEXT("UQuickTweenBase::SetTimeScale: Time scale must be positive.")))
 	{
-		result.Alpha = 1.f - result.Alpha;
+		return;
 	}
 
-	return result;
+	TimeScale = timeScale;
+	if (IsInStorage())
+	{
+		// ... time accumulated so far was played at the previous scale
+		Storage->FlushAccumulatedDelta(StorageSlot);
+		Storage->TimeScale[StorageSlot] = timeScale;
+	}
 }
 
-void UQuickTweenBase::ApplyAlphaValue(float alpha)
+void UQuickTweenBase::SetSignificanceSource(USceneComponent* source)
 {
-	ensureAlwaysMsgf(false, TEXT("UQuickTweenBase::ApplyAlphaValue: This method should be overridden in derived classes."));
+	SignificanceSource = source;
+	if (!source && IsInStorage())
+	{
+		Storage->UpdateInterval[StorageSlot] = 1;
+	}
+}
+
+void UQuickTweenBase::SetTarget(UObject* target)
+{
+	if (UQuickTweenManager* manager = Manager.Get())
+	{
+		manager->RetargetTween(this, target);
+		return;
+	}
+	Target = target;
+}
+
+void UQuickTweenBase::SetTargetProperty(UObject* target, FName channel)
+{
+	if (UQuickTweenManager* manager = Manager.Get())
+	{
+		manager->ClaimProperty(this, target, channel);
+		return;
+	}
+	Target = target;
+	PropertyChannel = channel;
 }
 
 void UQuickTweenBase::Play()
 {
 	if (HasOwner()) return;
 
-	const EQuickTweenState prevState = TweenState;
+	const EQuickTweenState prevState = GetTweenState();
 	if (RequestStateTransition(EQuickTweenState::Play))
 	{
 		if (prevState == EQuickTweenState::Idle)
 		{
-			ElapsedTime = bIsReversed ? GetTotalDuration() : 0.0f;
-			CurrentLoop = bIsReversed ? GetLoops() - 1 : 0;
+			SetElapsedTime(GetIsReversed() ? GetTotalDuration() : 0.0f);
+			SetCurrentLoop(GetIsReversed() ? GetLoops() - 1 : 0);
 			HandleOnStart();
+			if (!PropertyChannel.IsNone())
+			{
+				if (UQuickTweenManager* manager = Manager.Get())
+				{
+					manager->ResolvePropertyConflicts(this);
+				}
+			}
 		}
 	}
 }
@@ -227,7 +395,7 @@ void UQuickTweenBase::Reverse()
 {
 	if (HasOwner()) return;
 
-	bIsReversed = !bIsReversed;
+	SetIsReversed(!GetIsReversed());
 }
 
 void UQuickTweenBase::Restart()
@@ -244,7 +412,7 @@ void UQuickTweenBase::Complete(bool bSnapToEnd)
 	bSnapToEndOnComplete = bSnapToEnd;
 	if (RequestStateTransition(EQuickTweenState::Complete))
 	{
-		HandleOnComplete();
+		ApplyCompletion();
 		if (bAutoKill)
 		{
 			if (RequestStateTransition(EQuickTweenState::Kill))
@@ -267,15 +435,17 @@ void UQuickTweenBase::Kill()
 
 bool UQuickTweenBase::RequestStateTransition(EQuickTweenState newState)
 {
-	if (newState == TweenState) return false;
+	const EQuickTweenState currentState = GetTweenState();
+	if (newState == currentState) return false;
 
-	if (ValidTransitions[TweenState].Contains(newState))
+	if (ValidTransitions[currentState].Contains(newState))
 	{
-		TweenState = newState;
+		SetTweenState(newState);
+		QUICKTWEEN_TRACE_STATE(this, newState);
 		return true;
 	}
 
-	UE_LOG(LogQuickTweenBase, Warning, TEXT("Invalid state transition from %s to %s"),  *UEnum::GetValueAsString(TweenState), *UEnum::GetValueAsString(newState));
+	UE_LOG(LogQuickTweenBase, Warning, TEXT("Invalid state transition from %s to %s"),  *UEnum::GetValueAsString(currentState), *UEnum::GetValueAsString(newState));
 	return false;
 }
 
@@ -283,16 +453,25 @@ void UQuickTweenBase::HandleOnStart()
 {
 	if (bTriggerEvents && OnStart.IsBound())
 	{
+		SCOPE_CYCLE_COUNTER(STAT_QuickTween_Events);
 		OnStart.Broadcast(this);
 	}
 }
 
+void UQuickTweenBase::ApplyCompletion()
+{
+	// ... lets setters tell the final write apart, e.g. to always sweep it
+	TGuardValue<bool> completingGuard(bIsCompleting, true);
+	HandleOnComplete();
+}
+
 void UQuickTweenBase::HandleOnComplete()
 {
-	ElapsedTime = bIsReversed ? 0.0f : GetTotalDuration();
+	SetElapsedTime(GetIsReversed() ? 0.0f : GetTotalDuration());
 
 	if (bTriggerEvents && OnComplete.IsBound())
 	{
+		SCOPE_CYCLE_COUNTER(STAT_QuickTween_Events);
 		OnComplete.Broadcast(this);
 	}
 }
@@ -301,10 +480,51 @@ void UQuickTweenBase::HandleOnKill()
 {
 	if (bTriggerEvents && OnKilled.IsBound())
 	{
+		SCOPE_CYCLE_COUNTER(STAT_QuickTween_Events);
 		OnKilled.Broadcast(this);
 	}
 }
 
+void UQuickTweenBase::ResetForReuse()
+{
+	check(!IsInStorage());
+
+	OnStart.Clear();
+	OnUpdate.Clear();
+	OnComplete.Clear();
+	OnKilled.Clear();
+	OnLoop.Clear();
+
+	TweenState = EQuickTweenState::Idle;
+	ElapsedTime = 0.0f;
+	Duration = 0.0f;
+	TimeScale = 1.0f;
+	bIsReversed = false;
+	bWasActive = false;
+	bSnapToEndOnComplete = true;
+	bTriggerEvents = true;
+	EaseType = EEaseType::Linear;
+	EaseCurve = nullptr;
+	CurrentLoop = 0;
+	Loops = -1;
+	LoopType = ELoopType::Restart;
+	TweenTag = NAME_None;
+	Owner = nullptr;
+	bAutoKill = true;
+	bPlayWhilePaused = false;
+	bComputeInParallel = false;
+	TickGroup = EQuickTweenTickGroup::Default;
+	Priority = EQuickTweenPriority::Normal;
+	TimeChannel = NAME_None;
+	SignificanceSource.Reset();
+	Target.Reset();
+	PropertyChannel = NAME_None;
+	YieldedTo.Reset();
+	bCullWhenNotRendered = false;
+	WorldContextObject = nullptr;
+	Manager.Reset();
+}
+
 void UQuickTweenBase::AssignOnStartEvent(FDynamicDelegateTween callback)
 {
 	OnStart.AddUFunction(callback.GetUObject(), callback.GetFunctionName());
@@ -4,6 +4,8 @@
 #include "Tweens/QuickTweenSequence.h"
 
 #include "QuickTweenManager.h"
+#include "QuickTweenStats.h"
+#include "QuickTweenTrace.h"
 #include "Utils/CommonValues.h"
 
 UQuickTweenSequence::~UQuickTweenSequence()
@@ -29,7 +31,7 @@ void UQuickTweenSequence::SetUp(
 {
 	Loops = loops;
 	LoopType = loopType;
-	SequenceTweenId	= id;
+	SequenceTweenId	= id.IsEmpty() ? NAME_None : FName(*id);
 	WorldContextObject = worldContextObject;
 	bAutoKill	= bShouldAutoKill;
 	bPlayWhilePaused = bShouldPlayWhilePaused;
@@ -64,7 +66,8 @@ UQuickTweenSequence* UQuickTweenSequence::Join(UQuickTweenable* tween)
 		return Append(tween);
 	}
 
-	if (UQuickTweenManager* manager = UQuickTweenManager::Get(WorldContextObject))
+	UQuickTweenManager* manager = UQuickTweenManager::Get(WorldContextObject);
+	if (manager)
 	{
 		manager->RemoveTween(tween);
 	}
@@ -74,6 +77,12 @@ UQuickTweenSequence* UQuickTweenSequence::Join(UQuickTweenable* tween)
 	}
 	tween->SetOwner(this);
 
+	// ... indexed under its target once owned, so tweens playing on the same property resolve against this sequence
+	if (manager)
+	{
+		manager->TrackSequenceTween(tween);
+	}
+
 	FQuickTweenSequenceGroup& lastGroup = TweenGroups.Last();
 	lastGroup.Tweens.Add(tween);
 	lastGroup.Duration = FMath::Max(lastGroup.Duration, tween->GetTotalDuration());
@@ -94,7 +103,8 @@ UQuickTweenSequence* UQuickTweenSequence::Append(UQuickTweenable* tween)
 		return this;
 	}
 
-	if (UQuickTweenManager* manager = UQuickTweenManager::Get(WorldContextObject))
+	UQuickTweenManager* manager = UQuickTweenManager::Get(WorldContextObject);
+	if (manager)
 	{
 		manager->RemoveTween(tween);
 	}
@@ -104,6 +114,12 @@ UQuickTweenSequence* UQuickTweenSequence::Append(UQuickTweenable* tween)
 	}
 	tween->SetOwner(this);
 
+	// ... indexed under its target once owned, so tweens playing on the same property resolve against this sequence
+	if (manager)
+	{
+		manager->TrackSequenceTween(tween);
+	}
+
 	FQuickTweenSequenceGroup group;
 	group.Tweens.Add(tween);
 	group.Duration = tween->GetTotalDuration();
@@ -137,6 +153,7 @@ void UQuickTweenSequence::Update(float deltaTime)
 
 		if (bTriggerEvents && OnLoop.IsBound())
 		{
+			SCOPE_CYCLE_COUNTER(STAT_QuickTween_Events);
 			for (int32 i = 0; i < crossed; ++i)
 			{
 				OnLoop.Broadcast(this);
@@ -165,6 +182,7 @@ void UQuickTweenSequence::Update(float deltaTime)
 
 	if (bTriggerEvents && OnUpdate.IsBound())
 	{
+		SCOPE_CYCLE_COUNTER(STAT_QuickTween_Events);
 		OnUpdate.Broadcast(this);
 	}
 }
@@ -222,6 +240,7 @@ void UQuickTweenSequence::Evaluate(const FQuickTweenEvaluatePayload& payload, co
 
 		if (bTriggerEvents && OnLoop.IsBound())
 		{
+			SCOPE_CYCLE_COUNTER(STAT_QuickTween_Events);
 			for (int32 i = 0; i < crossed; ++i)
 			{
 				OnLoop.Broadcast(this);
@@ -233,6 +252,7 @@ void UQuickTweenSequence::Evaluate(const FQuickTweenEvaluatePayload& payload, co
 
 	if (bTriggerEvents && OnUpdate.IsBound())
 	{
+		SCOPE_CYCLE_COUNTER(STAT_QuickTween_Events);
 		OnUpdate.Broadcast(this);
 	}
 }
@@ -267,6 +287,9 @@ UQuickTweenSequence::FQuickTweenSequenceStateResult UQuickTweenSequence::Compute
 
 void UQuickTweenSequence::SeekTime(float loopLocalTime)
 {
+	SCOPE_CYCLE_COUNTER(STAT_QuickTween_SequenceSeek);
+	QUICKTWEEN_TRACE_SCOPE(QuickTween_SequenceSeekTime);
+
 	const bool bIsForward = loopLocalTime >= PreviousLoopLocalTime;
 
 	const auto evaluateAtTime = [&](float sequenceTime, bool bEnableEvents  = true)
@@ -377,6 +400,20 @@ UQuickTweenable* UQuickTweenSequence::GetTween(int32 index) const
 	return nullptr;
 }
 
+void UQuickTweenSequence::ForEachTween(TFunctionRef<void(UQuickTweenable*)> func) const
+{
+	for (const FQuickTweenSequenceGroup& group : TweenGroups)
+	{
+		for (UQuickTweenable* tween : group.Tweens)
+		{
+			if (tween)
+			{
+				func(tween);
+			}
+		}
+	}
+}
+
 void UQuickTweenSequence::Play()
 {
 	if (HasOwner()) return;
@@ -390,6 +427,10 @@ void UQuickTweenSequence::Play()
 			CurrentLoop = bIsReversed ? GetLoops() - 1 : 0;
 			PreviousLoopLocalTime = bIsReversed ? GetLoopDuration() : 0.0f;
 			HandleOnStart();
+			if (UQuickTweenManager* manager = UQuickTweenManager::Get(WorldContextObject))
+			{
+				manager->ResolvePropertyConflicts(this);
+			}
 		}
 	}
 }
@@ -450,6 +491,7 @@ bool UQuickTweenSequence::RequestStateTransition(EQuickTweenState newState)
 	if (ValidTransitions[SequenceState].Contains(newState))
 	{
 		SequenceState = newState;
+		QUICKTWEEN_TRACE_STATE(this, newState);
 		return true;
 	}
 
@@ -461,6 +503,7 @@ void UQuickTweenSequence::HandleOnStart()
 {
 	if (bTriggerEvents && OnStart.IsBound())
 	{
+		SCOPE_CYCLE_COUNTER(STAT_QuickTween_Events);
 		OnStart.Broadcast(this);
 	}
 }
@@ -480,6 +523,7 @@ void UQuickTweenSequence::HandleOnComplete()
 
 	if (bTriggerEvents && OnComplete.IsBound())
 	{
+		SCOPE_CYCLE_COUNTER(STAT_QuickTween_Events);
 		OnComplete.Broadcast(this);
 	}
 }
@@ -488,10 +532,55 @@ void UQuickTweenSequence::HandleOnKill()
 {
 	if (bTriggerEvents && OnKilled.IsBound())
 	{
+		SCOPE_CYCLE_COUNTER(STAT_QuickTween_Events);
 		OnKilled.Broadcast(this);
 	}
 }
 
+void UQuickTweenSequence::ResetForReuse()
+{
+	UQuickTweenManager* manager = UQuickTweenManager::Get(WorldContextObject);
+	for (const FQuickTweenSequenceGroup& group : TweenGroups)
+	{
+		for (UQuickTweenable* tween : group.Tweens)
+		{
+			if (!tween)
+			{
+				continue;
+			}
+
+			tween->SetOwner(nullptr);
+			if (manager)
+			{
+				manager->ReleaseToPool(tween);
+			}
+		}
+	}
+	TweenGroups.Reset();
+
+	OnStart.Clear();
+	OnUpdate.Clear();
+	OnComplete.Clear();
+	OnKilled.Clear();
+	OnLoop.Clear();
+
+	SequenceState = EQuickTweenState::Idle;
+	ElapsedTime = 0.0f;
+	bIsReversed = false;
+	bWasActive = false;
+	PreviousLoopLocalTime = 0.0f;
+	bSnapToEndOnComplete = true;
+	bTriggerEvents = true;
+	CurrentLoop = 1;
+	Loops = -1;
+	LoopType = ELoopType::Restart;
+	SequenceTweenId = NAME_None;
+	bAutoKill = true;
+	bPlayWhilePaused = false;
+	WorldContextObject = nullptr;
+	Owner = nullptr;
+}
+
 void UQuickTweenSequence::AssignOnStartEvent(FDynamicDelegateTweenSequence callback)
 {
 	OnStart.AddUFunction(callback.GetUObject(), callback.GetFunctionName());
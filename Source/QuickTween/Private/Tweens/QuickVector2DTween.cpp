@@ -5,11 +5,9 @@
 #include "Curves/CurveFloat.h"
 #include "Utils/EaseFunctions.h"
 
-void UQuickVector2DTween::ApplyAlphaValue(float alpha)
+void UQuickVector2DTween::ApplyEasedAlphaValue(float easedAlpha)
 {
-	const FVector2D value = GetEaseCurve() ?
-	FEaseFunctions<FVector2D>::Ease(StartValue.Get(FVector2D::ZeroVector), EndValue.Get(FVector2D::ZeroVector), alpha, GetEaseCurve()) :
-	FEaseFunctions<FVector2D>::Ease(StartValue.Get(FVector2D::ZeroVector), EndValue.Get(FVector2D::ZeroVector), alpha, GetEaseType());
+	const FVector2D value = TEaseLerp<FVector2D>::Lerp(StartValue.Get(FVector2D::ZeroVector), EndValue.Get(FVector2D::ZeroVector), easedAlpha, EEasePath::Default);
 	if (Setter.IsBound())
 	{
 		Setter.Execute(value, this);
@@ -56,7 +54,7 @@ void UQuickVector2DTween::HandleOnComplete()
 
 	bool bSnapToBeginning = !bSnapToEnd || (GetLoopType() == ELoopType::PingPong && GetLoops() % 2 == 0);
 	const FVector2D value = bSnapToBeginning ? StartValue.Get(FVector2D::ZeroVector) : EndValue.Get(FVector2D::ZeroVector);
-	if (Setter.IsBound())
+	if (Setter.IsBound() && !GetHasYieldedProperty())
 	{
 		Setter.Execute(value, this);
 	}
@@ -64,3 +62,15 @@ void UQuickVector2DTween::HandleOnComplete()
 
 	Super::HandleOnComplete();
 }
+
+void UQuickVector2DTween::ResetForReuse()
+{
+	From.Unbind();
+	To.Unbind();
+	Setter.Unbind();
+	StartValue.Reset();
+	EndValue.Reset();
+	CurrentValue = FVector2D::ZeroVector;
+
+	Super::ResetForReuse();
+}
@@ -6,11 +6,9 @@
 #include "Utils/EaseFunctions.h"
 
 
-void UQuickVectorTween::ApplyAlphaValue(float alpha)
+void UQuickVectorTween::ApplyEasedAlphaValue(float easedAlpha)
 {
-	const FVector value = GetEaseCurve() ?
-	FEaseFunctions<FVector>::Ease(StartValue.Get(FVector::ZeroVector), EndValue.Get(FVector::ZeroVector), alpha, GetEaseCurve()) :
-	FEaseFunctions<FVector>::Ease(StartValue.Get(FVector::ZeroVector), EndValue.Get(FVector::ZeroVector), alpha, GetEaseType());
+	const FVector value = TEaseLerp<FVector>::Lerp(StartValue.Get(FVector::ZeroVector), EndValue.Get(FVector::ZeroVector), easedAlpha, EEasePath::Default);
 	if (Setter.IsBound())
 	{
 		Setter.Execute(value, this);
@@ -53,7 +51,7 @@ void UQuickVectorTween::HandleOnComplete()
 
 	bool bSnapToBeginning = !bSnapToEnd || (GetLoopType() == ELoopType::PingPong && GetLoops() % 2 == 0);
 	const FVector value = bSnapToBeginning ? StartValue.Get(FVector::ZeroVector) : EndValue.Get(FVector::ZeroVector);
-	if (Setter.IsBound())
+	if (Setter.IsBound() && !GetHasYieldedProperty())
 	{
 		Setter.Execute(value, this);
 	}
@@ -61,3 +59,15 @@ void UQuickVectorTween::HandleOnComplete()
 
 	Super::HandleOnComplete();
 }
+
+void UQuickVectorTween::ResetForReuse()
+{
+	From.Unbind();
+	To.Unbind();
+	Setter.Unbind();
+	StartValue.Reset();
+	EndValue.Reset();
+	CurrentValue = FVector::ZeroVector;
+
+	Super::ResetForReuse();
+}
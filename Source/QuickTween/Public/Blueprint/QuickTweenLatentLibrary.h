@@ -373,6 +373,7 @@ public:
 	 * @param bShouldAutoKill If true the tween will be auto-killed when finished.
 	 * @param bShouldPlayWhilePaused If true the tween will update while paused.
 	 * @param bShouldAutoPlay If true the tween will start immediately after creation.
+	 * @param movePolicy Whether each location write sweeps for collision or teleports physics.
 	 * @return Pointer to the created UQuickVectorTween.
 	 */
 	UFUNCTION(BlueprintCallable, meta = (WorldContext = "worldContextObject", Latent, LatentInfo = "latentInfo", ExpandEnumAsExecs = "latentStep", Keywords = "Tween | Vector | Create | Make | Latent", HidePin = "latentStep"), Category = "QuickTween")
@@ -392,7 +393,8 @@ public:
 		const FString& tweenTag = "",
 		bool bShouldAutoKill = true,
 		bool bShouldPlayWhilePaused = false,
-		bool bShouldAutoPlay = false);
+		bool bShouldAutoPlay = false,
+		EQuickTweenMovePolicy movePolicy = EQuickTweenMovePolicy::Sweep);
 
 	/**
 	 * Create a latent MoveTo tween for a UWidget.
@@ -459,6 +461,7 @@ public:
 	 * @param bShouldAutoKill If true the tween will be auto-killed when finished.
 	 * @param bShouldPlayWhilePaused If true the tween will update while the game is paused.
 	 * @param bShouldAutoPlay If true the tween will start immediately after creation.
+	 * @param movePolicy Whether each location write sweeps for collision or teleports physics.
 	 * @return Pointer to the created UQuickVectorTween.
 	 */
 	UFUNCTION(BlueprintCallable, meta = (WorldContext = "worldContextObject", Latent, LatentInfo = "latentInfo", ExpandEnumAsExecs = "latentStep", Keywords = "Tween | Vector | Create | Make | Latent", HidePin = "latentStep"), Category = "QuickTween")
@@ -478,7 +481,8 @@ public:
 		const FString& tweenTag = "",
 		bool bShouldAutoKill = true,
 		bool bShouldPlayWhilePaused = false,
-		bool bShouldAutoPlay = false);
+		bool bShouldAutoPlay = false,
+		EQuickTweenMovePolicy movePolicy = EQuickTweenMovePolicy::Sweep);
 
 	/**
 	 * Create a latent MoveBy tween for a UWidget.
@@ -7,6 +7,10 @@
 #include "Utils/EaseType.h"
 #include "Utils/LoopType.h"
 #include "Utils/CommonValues.h"
+#include "QuickTweenHandle.h"
+#include "QuickTweenPool.h"
+#include "QuickTweenManager.h"
+#include "Templates/SubclassOf.h"
 #include "QuickTweenLibrary.generated.h"
 
 class UQuickEmptyTween;
@@ -19,6 +23,7 @@ class UQuickColorTween;
 class UQuickVector2DTween;
 class UQuickTweenable;
 class UQuickTweenSequence;
+class UQuickTweenGroup;
 class UQuickVectorTween;
 class UQuickRotatorTween;
 class UQuickFloatTween;
@@ -336,6 +341,7 @@ public:
 	 * @param bShouldAutoKill     If true the tween will be automatically killed when complete.
 	 * @param bShouldPlayWhilePaused If true the tween will update while game is paused.
 	 * @param bShouldAutoPlay     If true the tween will start playing immediately after creation.
+	 * @param movePolicy          Whether each location write sweeps for collision or teleports physics.
 	 * @return                    A UQuickVectorTween pointer controlling the movement.
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "Tween | Movement | SceneComponent", WorldContext = "worldContextObject"), Category = "QuickTween")
@@ -353,7 +359,8 @@ public:
 		const FString& tweenTag = "",
 		bool bShouldAutoKill = true,
 		bool bShouldPlayWhilePaused = false,
-		bool bShouldAutoPlay = false);
+		bool bShouldAutoPlay = false,
+		EQuickTweenMovePolicy movePolicy = EQuickTweenMovePolicy::Sweep);
 
 	/**
 	 * Create a Vector2D tween that moves a UWidget to a target absolute position.
@@ -418,6 +425,7 @@ public:
 	 * @param bShouldAutoKill     If true the tween will be automatically killed when complete.
 	 * @param bShouldPlayWhilePaused If true the tween will update while the game is paused.
 	 * @param bShouldAutoPlay     If true the tween will start playing immediately after creation.
+	 * @param movePolicy          Whether each location write sweeps for collision or teleports physics.
 	 * @return                    A UQuickVectorTween pointer controlling the movement.
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "Tween | Movement | SceneComponent", WorldContext = "worldContextObject"), Category = "QuickTween")
@@ -435,7 +443,8 @@ public:
 		const FString& tweenTag = "",
 		bool bShouldAutoKill = true,
 		bool bShouldPlayWhilePaused = false,
-		bool bShouldAutoPlay = false);
+		bool bShouldAutoPlay = false,
+		EQuickTweenMovePolicy movePolicy = EQuickTweenMovePolicy::Sweep);
 
 	/**
 	 * Create a Vector2D tween that moves a UWidget by a relative offset.
@@ -1332,6 +1341,19 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (Keywords = "Tween | Find | By Tag", WorldContext = "worldContextObject"), Category = "QuickTween")
 	static UQuickTweenable* QuickTweenFindTweenByTag(const UObject* worldContextObject, const FString& tweenTag);
 
+	/**
+	 * Find all active QuickTweens with the given tag within the world context.
+	 *
+	 * Tags may form a dot-separated hierarchy (e.g. "UI.Menu.Fade"); tag comparison is case-insensitive.
+	 *
+	 * @param worldContextObject  Context object used to locate the world that contains the tweens.
+	 * @param tweenTag            Tag identifying the tweens to find.
+	 * @param bMatchChildTags     If true, tweens tagged below \p tweenTag (e.g. "UI.Menu" for "UI") also match.
+	 * @return                    An array of UQuickTweenable pointers with the tag.
+	 */
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "Tween | Find | All | By Tag", WorldContext = "worldContextObject"), Category = "QuickTween")
+	static TArray<UQuickTweenable*> QuickTweenFindAllTweensByTag(const UObject* worldContextObject, const FString& tweenTag, bool bMatchChildTags = false);
+
 	/**
 	 * Find all active QuickTweens that match a specified predicate within the world context.
 	 *
@@ -1358,6 +1380,30 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (Keywords = "Tween | Kill | All", WorldContext = "worldContextObject"), Category = "QuickTween")
 	static void QuickTweenKillAllTweens(const UObject* worldContextObject);
 
+	/**
+	 * Kill every QuickTween animating the target (see UQuickTweenBase::SetTarget).
+	 *
+	 * Tweens created by the component, widget and material functions are registered with their target
+	 * automatically and are also killed once it is destroyed.
+	 *
+	 * @param worldContextObject Context object used to locate the world that contains the tweens.
+	 * @param target             Object whose tweens to kill.
+	 * @return                   Number of tweens killed.
+	 */
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "Tween | Kill | Target", WorldContext = "worldContextObject"), Category = "QuickTween")
+	static int32 QuickTweenKillTweensOf(const UObject* worldContextObject, const UObject* target);
+
+	/**
+	 * Create an empty tween group. Play, Pause, Kill, Complete, Reverse and SetTimeScale on the group only touch
+	 * its members, unlike the *AllTweens functions which sweep every tween of the world. Keep a reference to it.
+	 *
+	 * @param worldContextObject Context object used to locate the world that owns the manager.
+	 * @param groupName          Optional name of the group, for debugging.
+	 * @return                   The new group, or null if the manager could not be found.
+	 */
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "Tween | Group | Create | Make", WorldContext = "worldContextObject"), Category = "QuickTween")
+	static UQuickTweenGroup* QuickTweenCreateGroup(const UObject* worldContextObject, FName groupName = NAME_None);
+
 	/**
 	 * Pause all active QuickTweens within the specified world context.
 	 *
@@ -1432,4 +1478,143 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, meta = (Keywords = "Tween | Some", WorldContext = "worldContextObject"), Category = "QuickTween")
 	static void QuickTweenExecuteActionByPredicate(const UObject* worldContextObject, const FQuickConstTweenableAction& predicate, const FQuickTweenableAction& action);
+
+	/**
+	 * Start or resume the tween referenced by a handle. No-op for a stale handle.
+	 *
+	 * @param handle Handle obtained from GetTweenHandle.
+	 */
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "Tween | Handle | Play"), Category = "QuickTween")
+	static void QuickTweenPlayHandle(const FQuickTweenHandle& handle);
+
+	/**
+	 * Pause the tween referenced by a handle. No-op for a stale handle.
+	 *
+	 * @param handle Handle obtained from GetTweenHandle.
+	 */
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "Tween | Handle | Pause"), Category = "QuickTween")
+	static void QuickTweenPauseHandle(const FQuickTweenHandle& handle);
+
+	/**
+	 * Kill the tween referenced by a handle. No-op for a stale handle.
+	 *
+	 * @param handle Handle obtained from GetTweenHandle.
+	 */
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "Tween | Handle | Kill"), Category = "QuickTween")
+	static void QuickTweenKillHandle(const FQuickTweenHandle& handle);
+
+	/**
+	 * Check whether a handle still refers to a live tween.
+	 *
+	 * @param handle Handle obtained from GetTweenHandle.
+	 * @return       True if the tween is registered and not killed.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "Tween | Handle | Valid | Alive"), Category = "QuickTween")
+	static bool QuickTweenIsHandleAlive(const FQuickTweenHandle& handle);
+
+	/**
+	 * Get the elapsed time of the tween referenced by a handle.
+	 *
+	 * @param handle Handle obtained from GetTweenHandle.
+	 * @return       Elapsed time in seconds, or 0 for a stale handle.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "Tween | Handle | Time"), Category = "QuickTween")
+	static float QuickTweenGetHandleElapsedTime(const FQuickTweenHandle& handle);
+
+	/**
+	 * Resolve the tween referenced by a handle.
+	 *
+	 * @param handle Handle obtained from GetTweenHandle.
+	 * @return       The tween, or nullptr for a stale handle.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "Tween | Handle | Get"), Category = "QuickTween")
+	static UQuickTweenable* QuickTweenResolveHandle(const FQuickTweenHandle& handle);
+
+	/**
+	 * Fill the tween pool of a class so upcoming tweens are recycled instead of allocated.
+	 * Only used while QuickTween.Pool is enabled.
+	 *
+	 * @param worldContextObject Context object used to locate the world that owns the pool.
+	 * @param tweenClass         Concrete tween class to prewarm (e.g. QuickVectorTween).
+	 * @param count              Desired number of free tweens of the class.
+	 */
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "Tween | Pool | Prewarm", WorldContext = "worldContextObject"), Category = "QuickTween")
+	static void QuickTweenPrewarmPool(const UObject* worldContextObject, TSubclassOf<UQuickTweenable> tweenClass, int32 count);
+
+	/**
+	 * Get the pool statistics of a tween class.
+	 *
+	 * @param worldContextObject Context object used to locate the world that owns the pool.
+	 * @param tweenClass         Concrete tween class to query.
+	 * @return                   Free, active, high-water-mark, allocated and reused counts. Zeroed if the class was never pooled.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "Tween | Pool | Stats", WorldContext = "worldContextObject"), Category = "QuickTween")
+	static FQuickTweenPoolStats QuickTweenGetPoolStats(const UObject* worldContextObject, TSubclassOf<UQuickTweenable> tweenClass);
+
+	/**
+	 * Get the frame budget report of the last frame tweens were updated in (see QuickTween.FrameBudgetMs).
+	 *
+	 * @param worldContextObject Context object used to locate the world that owns the manager.
+	 * @return                   Budget, time spent, estimated deferred time and updated/deferred tween counts.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "Tween | Budget | Stats", WorldContext = "worldContextObject"), Category = "QuickTween")
+	static FQuickTweenBudgetStats QuickTweenGetBudgetStats(const UObject* worldContextObject);
+
+	/**
+	 * Set the time scale of a time channel. Every tween subscribed to it (SetTimeChannel) is affected at once.
+	 *
+	 * @param worldContextObject Context object used to locate the world that owns the manager.
+	 * @param channel            Channel name, None for the default channel.
+	 * @param timeScale          Multiplier applied on top of each tween's own time scale.
+	 */
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "Tween | Time | Channel", WorldContext = "worldContextObject"), Category = "QuickTween")
+	static void QuickTweenSetTimeChannelScale(const UObject* worldContextObject, FName channel, float timeScale = 1.0f);
+
+	/**
+	 * Pause or resume every tween subscribed to a time channel.
+	 *
+	 * @param worldContextObject Context object used to locate the world that owns the manager.
+	 * @param channel            Channel name, None for the default channel.
+	 * @param bPaused            Whether the channel is paused.
+	 */
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "Tween | Time | Channel", WorldContext = "worldContextObject"), Category = "QuickTween")
+	static void QuickTweenSetTimeChannelPaused(const UObject* worldContextObject, FName channel, bool bPaused);
+
+	/**
+	 * Get the time scale of a time channel.
+	 *
+	 * @param worldContextObject Context object used to locate the world that owns the manager.
+	 * @param channel            Channel name, None for the default channel.
+	 * @return                   The channel time scale, 1 if it was never set.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "Tween | Time | Channel", WorldContext = "worldContextObject"), Category = "QuickTween")
+	static float QuickTweenGetTimeChannelScale(const UObject* worldContextObject, FName channel);
+
+	/**
+	 * Check whether a time channel is paused.
+	 *
+	 * @param worldContextObject Context object used to locate the world that owns the manager.
+	 * @param channel            Channel name, None for the default channel.
+	 * @return                   True if the channel is paused.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "Tween | Time | Channel", WorldContext = "worldContextObject"), Category = "QuickTween")
+	static bool QuickTweenIsTimeChannelPaused(const UObject* worldContextObject, FName channel);
+
+	/**
+	 * Set how a component, widget or material tween starting to play treats the running tweens writing the same target property.
+	 *
+	 * @param worldContextObject Context object used to locate the world that owns the manager.
+	 * @param policy             KillPrevious, CompletePrevious, Blend (the previous tween stops writing) or Ignore.
+	 */
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "Tween | Conflict | Policy", WorldContext = "worldContextObject"), Category = "QuickTween")
+	static void QuickTweenSetConflictPolicy(const UObject* worldContextObject, EQuickTweenConflictPolicy policy);
+
+	/**
+	 * Get how a new tween treats the running tweens writing the same target property.
+	 *
+	 * @param worldContextObject Context object used to locate the world that owns the manager.
+	 * @return                   The conflict policy, Ignore by default.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "Tween | Conflict | Policy", WorldContext = "worldContextObject"), Category = "QuickTween")
+	static EQuickTweenConflictPolicy QuickTweenGetConflictPolicy(const UObject* worldContextObject);
 };
@@ -0,0 +1,218 @@
+﻿// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utils/CommonValues.h"
+#include "Utils/EaseFunctions.h"
+#include "Utils/EaseType.h"
+#include "Utils/LoopType.h"
+
+/**
+ * Generational handle to a native tween. Plain data, stale once the tween completed or was killed.
+ */
+struct FQuickNativeTweenHandle
+{
+	/** Slot in the owning FQuickNativeTweenStorage. */
+	int32 Slot = INDEX_NONE;
+
+	/** Generation the slot had when issued, 0 for an unset handle. */
+	uint32 Generation = 0;
+
+	/** Whether the handle was ever issued. Does not check liveness. */
+	[[nodiscard]] bool IsSet() const { return Generation != 0; }
+
+	bool operator==(const FQuickNativeTweenHandle& other) const { return Slot == other.Slot && Generation == other.Generation; }
+	bool operator!=(const FQuickNativeTweenHandle& other) const { return !(*this == other); }
+};
+
+/**
+ * Settings of a native tween. Mirrors the UQuickTweenBase factory parameters.
+ */
+struct FQuickNativeTweenParams
+{
+	/** Duration of a single loop in seconds. */
+	float Duration = 1.0f;
+
+	/** Time scale multiplier. */
+	float TimeScale = 1.0f;
+
+	/** Easing type, custom curves are not supported on the native path. */
+	EEaseType EaseType = EEaseType::Linear;
+
+	/** Number of loops (-1 = infinite). */
+	int32 Loops = 1;
+
+	/** Looping behavior. */
+	ELoopType LoopType = ELoopType::Restart;
+
+	/** Whether the tween keeps playing while the game is paused. */
+	bool bPlayWhilePaused = false;
+
+	/** Whether the tween starts playing right away. */
+	bool bAutoPlay = true;
+
+	/** Called once after the final value was written. The tween is released right after. */
+	TFunction<void()> OnComplete;
+};
+
+/**
+ * Native-only tween: a plain struct with no reflection, delegates or GC tracking.
+ *
+ * Lives inside FQuickNativeTweenStorage and is addressed through FQuickNativeTweenHandle.
+ * Uses the same timing and easing rules as UQuickTweenBase (FQuickTweenTiming), and
+ * drives a lambda setter with the eased alpha. Released as soon as it completes.
+ */
+struct QUICKTWEEN_API FQuickNativeTween
+{
+	/** Start or resume playback. */
+	void Play();
+
+	/** Pause playback. */
+	void Pause();
+
+	/** Kill the tween without writing a final value. The handle goes stale immediately. */
+	void Kill() { State = EQuickTweenState::Kill; }
+
+	[[nodiscard]] bool GetIsPlaying() const { return State == EQuickTweenState::Play; }
+
+	[[nodiscard]] float GetElapsedTime() const { return ElapsedTime; }
+
+	[[nodiscard]] float GetTotalDuration() const { return Loops == INFINITE_LOOPS ? TNumericLimits<float>::Max() : Duration * Loops; }
+
+private:
+	friend class FQuickNativeTweenStorage;
+
+	/** Receives the eased alpha every update. */
+	TFunction<void(float)> Setter;
+
+	/** Called once on completion. */
+	TFunction<void()> OnComplete;
+
+	float ElapsedTime = 0.0f;
+	float Duration = 1.0f;
+	float TimeScale = 1.0f;
+
+	/** Eased alpha produced by the compute pass for this frame. */
+	float EasedAlpha = 0.0f;
+
+	int32 Loops = 1;
+
+	/** Slot in the handle table, used to re-point it when the tween moves. */
+	int32 Slot = INDEX_NONE;
+
+	ELoopType LoopType = ELoopType::Restart;
+	EEaseType EaseType = EEaseType::Linear;
+	EQuickTweenState State = EQuickTweenState::Idle;
+	bool bIsReversed = false;
+	bool bPlayWhilePaused = false;
+
+	/** Whether the compute pass advanced the tween this frame. */
+	bool bHasUpdate = false;
+
+	/** Whether the compute pass found the tween completed this frame. */
+	bool bHasCompleted = false;
+};
+
+/**
+ * Dense storage and update loop for FQuickNativeTween, owned by UQuickTweenManager.
+ *
+ * Tweens are packed in one array and advanced in a parallel pass (pure math), then their setters
+ * run on the game thread. Handles resolve through a slot table with generations in O(1).
+ *
+ * Usage notes:
+ *  - Tweens created from a setter or completion callback are added once the current pass is over.
+ *  - Killed and completed tweens are compacted with swap-and-pop at the end of every Tick.
+ */
+class QUICKTWEEN_API FQuickNativeTweenStorage
+{
+public:
+
+	/**
+	 * Create a native tween.
+	 *
+	 * @param setter Receives the eased alpha; endpoints are written exactly as 0 or 1 on completion.
+	 * @param params Timing settings and completion callback.
+	 * @return Handle to the new tween.
+	 */
+	FQuickNativeTweenHandle Add(TFunction<void(float)> setter, FQuickNativeTweenParams params);
+
+	/**
+	 * Create a native tween interpolating between two values.
+	 *
+	 * @param from Start value.
+	 * @param to End value.
+	 * @param setter Receives the interpolated value.
+	 * @param params Timing settings and completion callback.
+	 * @return Handle to the new tween.
+	 */
+	template<typename T>
+	FQuickNativeTweenHandle Add(const T& from, const T& to, TFunction<void(const T&)> setter, FQuickNativeTweenParams params)
+	{
+		return Add(
+			[from, to, setter = MoveTemp(setter)](float easedAlpha)
+			{
+				setter(TEaseLerp<T>::Lerp(from, to, easedAlpha, EEasePath::Default));
+			},
+			MoveTemp(params));
+	}
+
+	/** Resolve a handle, or null if the tween completed or was killed. Valid until the next Add or Tick. */
+	[[nodiscard]] FQuickNativeTween* Find(const FQuickNativeTweenHandle& handle);
+
+	/**
+	 * Advance, ease and apply every playing tween, then release completed and killed ones.
+	 *
+	 * @param deltaTime Frame delta in seconds.
+	 * @param bIsWorldPaused Whether the world is paused; only PlayWhilePaused tweens advance.
+	 * @param bForceSerial Run the compute pass on the game thread.
+	 * @param minBatchSize Minimum number of tweens per worker in the compute pass.
+	 */
+	void Tick(float deltaTime, bool bIsWorldPaused, bool bForceSerial, int32 minBatchSize);
+
+	/** Number of live and pending tweens. */
+	[[nodiscard]] int32 Num() const { return Tweens.Num() + PendingTweens.Num(); }
+
+	/** Drop every tween without calling completion callbacks. */
+	void Reset();
+
+	/** Heap memory held by the tween and slot arrays, in bytes. Setter captures are not included. */
+	[[nodiscard]] SIZE_T GetAllocatedSize() const { return Tweens.GetAllocatedSize() + PendingTweens.GetAllocatedSize() + Slots.GetAllocatedSize() + FreeSlots.GetAllocatedSize(); }
+
+private:
+
+	struct FSlot
+	{
+		/** Index in Tweens, or in PendingTweens while bIsPending. */
+		int32 Index = INDEX_NONE;
+		uint32 Generation = 0;
+		bool bIsPending = false;
+	};
+
+	/** Release the slot of a removed tween. */
+	void FreeSlot(int32 slot);
+
+	/** Swap-and-pop every killed tween. */
+	void Compact();
+
+	/** Move the tweens created during Tick into the dense array. */
+	void FlushPending();
+
+	/** Packed live tweens. */
+	TArray<FQuickNativeTween> Tweens;
+
+	/** Tweens created during Tick. */
+	TArray<FQuickNativeTween> PendingTweens;
+
+	/** Handle table. */
+	TArray<FSlot> Slots;
+
+	/** Released handle slots. */
+	TArray<int32> FreeSlots;
+
+	/** Last generation handed out. */
+	uint32 LastGeneration = 0;
+
+	/** Whether Tick is iterating Tweens. */
+	bool bIsTicking = false;
+};
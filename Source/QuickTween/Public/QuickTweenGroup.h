@@ -0,0 +1,95 @@
+﻿// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "QuickTweenGroup.generated.h"
+
+class UQuickTweenable;
+class UQuickTweenManager;
+
+/**
+ * Named set of registered tweens controlled together.
+ *
+ * The manager maintains the membership list: a tween joins with Add and leaves when removed or once
+ * the manager unregisters it (killed, compacted or joined into a sequence). Every bulk call only touches
+ * the members, so it costs O(group) instead of a sweep over every tween of the world.
+ *
+ * Usage notes:
+ *  - Create a group with UQuickTweenManager::CreateGroup or QuickTweenCreateGroup and keep a reference to it.
+ *  - A tween belongs to at most one group, adding it to another one moves it.
+ */
+UCLASS(BlueprintType)
+class QUICKTWEEN_API UQuickTweenGroup : public UObject
+{
+	GENERATED_BODY()
+public:
+
+	/** Add a registered tween to the group, moving it out of its previous group. */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Group")
+	void Add(UQuickTweenable* tween);
+
+	/** Remove a tween from the group, ignored if it is not a member. */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Group")
+	void Remove(UQuickTweenable* tween);
+
+	/** Start or resume playback of every member. */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Group")
+	void Play();
+
+	/** Pause playback of every member. */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Group")
+	void Pause();
+
+	/** Invert the playback direction of every member. */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Group")
+	void Reverse();
+
+	/** Restart every member from its beginning, they must be played again. */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Group")
+	void Restart();
+
+	/** Immediately complete every member.
+	 * @param bSnapToEnd If true, snap properties to final state when completing.
+	 */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Group")
+	void Complete(bool bSnapToEnd = true);
+
+	/** Kill every member, they leave the group once the manager removes them. */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Group")
+	void Kill();
+
+	/** Set the time scale of every member. Sequences always run at time scale 1 and are skipped.
+	 * @param timeScale New speed multiplier, 1 for normal speed.
+	 */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Group")
+	void SetTimeScale(float timeScale);
+
+	/** Name given on creation, NAME_None if unnamed. */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Group")
+	[[nodiscard]] FName GetGroupName() const { return GroupName; }
+
+	/** Number of members, killed ones included until the manager removes them. */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Group")
+	[[nodiscard]] int32 Num() const { return Members.Num(); }
+
+	/** Members that are not pending kill. */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Group")
+	[[nodiscard]] TArray<UQuickTweenable*> GetTweens() const;
+
+private:
+	friend class UQuickTweenManager;
+
+	/** Invoke func on a snapshot of the members that are not pending kill, so it may add, remove or kill tweens. */
+	void ForEachMember(TFunctionRef<void(UQuickTweenable*)> func) const;
+
+	/** Members in no particular order, each knows its index through UQuickTweenable::GroupSlot. */
+	UPROPERTY(Transient)
+	TArray<UQuickTweenable*> Members = {};
+
+	/** Manager maintaining the membership. */
+	TWeakObjectPtr<UQuickTweenManager> Manager;
+
+	/** Name given on creation. */
+	FName GroupName = NAME_None;
+};
@@ -0,0 +1,103 @@
+﻿// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "QuickTweenHandle.generated.h"
+
+class UQuickTweenable;
+
+/**
+ * Generational handle to a tween registered with a UQuickTweenManager.
+ *
+ * Plain data (slot index + generation), so it can be stored in hot gameplay structs
+ * without UObject reference tracking. A handle stays alive while its tween is driven
+ * by a manager; once the tween is killed, removed or joined into a sequence the handle
+ * goes stale, which is detected in O(1) by comparing generations.
+ *
+ * Usage notes:
+ *  - Get a handle with UQuickTweenable::GetTweenHandle.
+ *  - Every call on a stale handle is a safe no-op.
+ */
+USTRUCT(BlueprintType)
+struct QUICKTWEEN_API FQuickTweenHandle
+{
+	GENERATED_BODY()
+
+	/** Start or resume playback of the tween. */
+	void Play() const;
+
+	/** Pause playback of the tween. */
+	void Pause() const;
+
+	/** Kill the tween, the handle goes stale immediately. */
+	void Kill() const;
+
+	/** Whether the handle still refers to a live tween. */
+	[[nodiscard]] bool IsAlive() const;
+
+	/** Elapsed time of the tween, or 0 for a stale handle. */
+	[[nodiscard]] float GetElapsedTime() const;
+
+	/** Resolve the tween, or null for a stale handle. */
+	[[nodiscard]] UQuickTweenable* Get() const;
+
+	/** Whether the handle was ever issued. Does not check liveness, see IsAlive. */
+	[[nodiscard]] bool IsSet() const { return Generation != 0; }
+
+	/** Clear the handle. */
+	void Reset() { *this = FQuickTweenHandle(); }
+
+	bool operator==(const FQuickTweenHandle& other) const { return Index == other.Index && Generation == other.Generation; }
+	bool operator!=(const FQuickTweenHandle& other) const { return !(*this == other); }
+
+	friend uint32 GetTypeHash(const FQuickTweenHandle& handle) { return HashCombine(::GetTypeHash(handle.Index), ::GetTypeHash(handle.Generation)); }
+
+private:
+	friend class FQuickTweenHandleRegistry;
+
+	/** Slot in the handle registry. */
+	UPROPERTY()
+	int32 Index = INDEX_NONE;
+
+	/** Generation the slot had when issued, 0 for an unset handle. */
+	UPROPERTY()
+	uint32 Generation = 0;
+};
+
+/**
+ * Process-wide table resolving FQuickTweenHandle to tweens, shared by every manager so handles
+ * need no world context. Game thread only; slots are recycled through a free list and every
+ * issue takes a fresh generation so a stale handle never matches a recycled slot.
+ */
+class QUICKTWEEN_API FQuickTweenHandleRegistry
+{
+public:
+
+	/** Issue a new handle for a tween. */
+	static FQuickTweenHandle Issue(UQuickTweenable* tween);
+
+	/** Invalidate a handle and recycle its slot. No-op for stale handles. */
+	static void Release(const FQuickTweenHandle& handle);
+
+	/** Resolve a handle, or null if it is stale. O(1). */
+	[[nodiscard]] static UQuickTweenable* Resolve(const FQuickTweenHandle& handle);
+
+private:
+
+	struct FSlot
+	{
+		/** Weak so a tween destroyed without being released never resolves. */
+		TWeakObjectPtr<UQuickTweenable> Tween;
+		uint32 Generation = 0;
+	};
+
+	/** Slot table indexed by FQuickTweenHandle::Index. */
+	static TArray<FSlot> Slots;
+
+	/** Indices of released slots. */
+	static TArray<int32> FreeSlots;
+
+	/** Last generation handed out, shared by all slots. */
+	static uint32 LastGeneration;
+};
@@ -3,8 +3,114 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "QuickTweenStorage.h"
+#include "QuickTweenPool.h"
+#include "QuickNativeTween.h"
+#include "QuickTweenTransformBatch.h"
+#include "QuickTweenHandle.h"
+#include "Containers/Queue.h"
+#include "Tasks/Task.h"
+#include "Templates/SubclassOf.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Engine/EngineTypes.h"
 #include "QuickTweenManager.generated.h"
 
+class UQuickTweenManager;
+class UQuickTweenBase;
+class USceneComponent;
+class AActor;
+class UQuickTweenGroup;
+
+/**
+ * Frame budget report of the storage-backed tween updates of one frame.
+ */
+USTRUCT(BlueprintType)
+struct QUICKTWEEN_API FQuickTweenBudgetStats
+{
+	GENERATED_BODY()
+
+	/** Budget the frame ran with (QuickTween.FrameBudgetMs), 0 when unbudgeted. */
+	UPROPERTY(BlueprintReadOnly, Category = "QuickTween|Budget")
+	float BudgetMs = 0.0f;
+
+	/** Time spent updating tweens, in milliseconds. */
+	UPROPERTY(BlueprintReadOnly, Category = "QuickTween|Budget")
+	float SpentMs = 0.0f;
+
+	/** Estimated update time pushed to later frames, in milliseconds. */
+	UPROPERTY(BlueprintReadOnly, Category = "QuickTween|Budget")
+	float DeferredMs = 0.0f;
+
+	/** Largest tween time (seconds) a skipped tween has to catch up. */
+	UPROPERTY(BlueprintReadOnly, Category = "QuickTween|Budget")
+	float MaxDeferredTime = 0.0f;
+
+	/** Tweens updated. */
+	UPROPERTY(BlueprintReadOnly, Category = "QuickTween|Budget")
+	int32 NumUpdated = 0;
+
+	/** Playing tweens skipped, their time is carried over to the next update. */
+	UPROPERTY(BlueprintReadOnly, Category = "QuickTween|Budget")
+	int32 NumDeferred = 0;
+};
+
+/**
+ * Tween command queued from any thread, executed by the manager at the start of its next Tick.
+ */
+struct FQuickTweenCommand
+{
+	enum class EType : uint8
+	{
+		Create,
+		Play,
+		Pause,
+		Kill
+	};
+
+	EType Type = EType::Create;
+
+	/** Target of Play, Pause and Kill. */
+	FQuickTweenHandle Handle;
+
+	/** Creates and sets up the tween on the game thread, receives the manager as world context. Create only. */
+	TFunction<UQuickTweenable*(UObject*)> Factory;
+
+	/** Optional, receives the handle of the created tween on the game thread. Create only. */
+	TFunction<void(const FQuickTweenHandle&)> OnCreated;
+};
+
+/**
+ * Tick function updating the tweens of one EQuickTweenTickGroup inside the matching engine tick group.
+ * One per group in use, registered on demand by UQuickTweenManager::EnsureTickFunction.
+ */
+USTRUCT()
+struct FQuickTweenManagerTickFunction : public FTickFunction
+{
+	GENERATED_BODY()
+
+	/** Manager to update. */
+	UQuickTweenManager* Manager = nullptr;
+
+	/** Tween group this function updates. */
+	EQuickTweenTickGroup Group = EQuickTweenTickGroup::Default;
+
+	/** Whether this function applies the Pipelined pass launched earlier in the frame instead of updating Group. */
+	bool bIsPipelineSync = false;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+
+	virtual FString DiagnosticMessage() override;
+};
+
+template<>
+struct TStructOpsTypeTraits<FQuickTweenManagerTickFunction> : public TStructOpsTypeTraitsBase2<FQuickTweenManagerTickFunction>
+{
+	enum
+	{
+		WithCopy = false
+	};
+};
+
 /**
  * World-scoped manager that updates active tweens each frame.
  * Implements a world subsystem to live with the UWorld and implements
@@ -12,6 +118,66 @@
  *
  * Use UQuickTweenManager::Get(...) to retrieve the manager for a given
  * world context object.
+ *
+ * UQuickTweenBase instances keep their hot timing state in a dense
+ * FQuickTweenStorage owned by the manager, which is advanced in a single
+ * linear pass each frame. Other tweenables (e.g. sequences) are updated
+ * individually.
+ *
+ * Registration and removal are O(1): every tween knows its slot. Removals
+ * made while Tick iterates leave holes and adds are queued until the pass
+ * is over; holes and killed tweens are compacted once at the start of Tick.
+ *
+ * With QuickTween.Pool enabled, tweens created by the factories come from a
+ * per-class pool and go back to it once killed and compacted. A pooled tween
+ * pointer must not be used after the tween was killed; hold an
+ * FQuickTweenHandle instead, which goes stale safely.
+ *
+ * Native C++ callers that need no reflection can create FQuickNativeTween
+ * instances through CreateNativeTween: plain structs with a lambda setter,
+ * created and released without any UObject allocation.
+ *
+ * Tweens in EQuickTweenTickGroup::Default are updated by the tickable Tick.
+ * Tweens in any other group (UQuickTweenBase::SetTickGroup) are updated by
+ * a FQuickTweenManagerTickFunction registered in the matching engine tick
+ * group the first time the group is used.
+ *
+ * With QuickTween.FrameBudgetMs set, the storage-backed tweens of a frame
+ * are updated until the budget is spent, estimated from the measured cost
+ * per tween. Critical tweens (UQuickTweenBase::SetPriority) always update;
+ * Normal and then Cosmetic tweens are round-robined with what is left and
+ * catch up with their accumulated time once updated. GetBudgetStats reports
+ * what was deferred.
+ *
+ * Tweens with a significance source (UQuickTweenBase::SetSignificanceSource)
+ * are updated every 2nd, 4th or 8th frame while the source is beyond 1x, 2x
+ * or 4x QuickTween.LOD.BaseDistance from every player view, or at the rate
+ * returned by the hook installed with SetSignificanceHook. The rate is
+ * re-evaluated each time the tween updates, so it returns to full rate
+ * within a few frames of getting close.
+ *
+ * Named time channels (e.g. UI, Gameplay, Cinematic) scale or pause every
+ * tween subscribed to them (UQuickTweenBase::SetTimeChannel) with a single
+ * write. The channel factor is applied once per channel per pass, on top of
+ * each tween's own time scale.
+ *
+ * Scene component transform writes made by tween setters during an update
+ * go through a FQuickTweenTransformBatch (GetTransformBatch), so tweens
+ * moving, rotating and scaling the same component produce one transform
+ * update per component at the end of the update instead of one per tween.
+ *
+ * With QuickTween.FixedStep set, every tick group accumulates the frame
+ * delta and tweens advance by whole steps only, at most
+ * QuickTween.FixedStepMaxSubsteps per frame (time beyond that is dropped
+ * after a hitch). Elapsed times then only depend on the number of steps, so
+ * results are identical across frame rates. QuickTween.FixedStepInterpolate
+ * renders values between the last two steps instead of on the last one.
+ *
+ * Tick runs in two phases: a compute phase that evaluates loop, alpha and
+ * easing of the tweens that opted in (UQuickTweenBase::SetComputeInParallel)
+ * across worker threads, and a game-thread phase that runs setters and
+ * broadcasts events. Set QuickTween.ForceSerialCompute to 1 to run the
+ * compute phase on the game thread for comparison.
  */
 UCLASS()
 class QUICKTWEEN_API UQuickTweenManager final : public UWorldSubsystem, public FTickableGameObject
@@ -27,6 +193,41 @@ public:
 	 */
 	static UQuickTweenManager* Get(const UObject* worldContextObject);
 
+	/**
+	 * Create a tween object for a factory, recycled from the manager pool when QuickTween.Pool is enabled.
+	 *
+	 * @param tweenClass - Concrete tween class to create.
+	 * @param worldContextObject - Used to find the manager, and as outer when the tween is not pooled.
+	 * @return The tween in its default state, not set up yet.
+	 */
+	static UQuickTweenable* NewTween(UClass* tweenClass, UObject* worldContextObject);
+
+	/**
+	 * Transform batch to write scene component transforms through from tween setters.
+	 * Writes are queued while the manager updates and flushed once per component afterwards;
+	 * without a manager, or outside an update, they go straight to the component.
+	 *
+	 * @param worldContextObject - Used to find the manager, typically the component itself.
+	 * @return The manager batch, or a pass-through batch when no manager is available.
+	 */
+	static FQuickTweenTransformBatch& GetTransformBatch(const UObject* worldContextObject);
+
+	/**
+	 * Transform batch of the manager the tween was set up with, without resolving the world or subsystem.
+	 * Meant for setters, which run for every tween write.
+	 *
+	 * @param tween - Tween whose setter is writing.
+	 * @return The manager batch, or a pass-through batch when the tween has no manager.
+	 */
+	static FQuickTweenTransformBatch& GetTransformBatch(const UQuickTweenBase* tween);
+
+	/** Typed version of NewTween. */
+	template<typename TweenType>
+	static TweenType* NewTween(UObject* worldContextObject)
+	{
+		return CastChecked<TweenType>(NewTween(TweenType::StaticClass(), worldContextObject));
+	}
+
 	/**
 	 * Initialize the subsystem. Called when the world subsystem is created.
 	 *
@@ -55,22 +256,44 @@ public:
 	 */
 	virtual void Tick(float deltaTime) override;
 
+	/**
+	 * Update the storage-backed tweens of a tick group other than Default. Called by its tick function.
+	 *
+	 * @param deltaTime - Time elapsed since the last tick (in seconds).
+	 * @param group - Tick group to update.
+	 */
+	void TickGroup(float deltaTime, EQuickTweenTickGroup group);
+
+	/**
+	 * Apply the setters and events of the Pipelined pass, waiting for its math if still running. Called by its sync tick function.
+	 */
+	void SyncPipeline();
+
+	/**
+	 * Register the tick function of a group if it isn't yet. No-op for Default. Called whenever a tween is added
+	 * to the storage or changes group; while the world has no level yet the registration is retried every Default tick.
+	 *
+	 * @param group - Tick group that is about to be used.
+	 */
+	void EnsureTickFunction(EQuickTweenTickGroup group);
+
 	/**
 	 * Return a unique stat id for profiling this tickable object.
 	 */
 	virtual TStatId GetStatId() const override;
 
 	/**
-	 * Always tick this object (even when not actively rendered).
+	 * Tick this object only while IsTickable, so the engine asks every frame whether there is work to do.
 	 */
-	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Always; }
+	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
 
 	/**
 	 * Indicate whether this object should be ticked.
+	 * False when nothing is playing and there is nothing to compact, so idle and paused tweens cost nothing.
 	 *
 	 * @return true if tickable.
 	 */
-	virtual bool IsTickable() const override { return !QuickTweens.IsEmpty(); }
+	virtual bool IsTickable() const override;
 
 	/**
 	 * Indicate whether this object is tickable in the editor.
@@ -88,13 +311,14 @@ public:
 
 	/**
 	 * Register a tween with the manager so it will be updated on Tick.
+	 * Called during Tick, the tween is registered once the current pass is over.
 	 *
 	 * @param tween - Pointer to the UQuickTweenable to add. Manager does not take ownership.
 	 */
 	void AddTween(class UQuickTweenable* tween);
 
 	/**
-	 * Unregister a tween so it will no longer be updated.
+	 * Unregister a tween so it will no longer be updated. O(1).
 	 *
 	 * @param tween - Pointer to the UQuickTweenable to remove.
 	 */
@@ -127,12 +351,395 @@ public:
 	 * @param predicate - Function that returns true for the desired tweens.
 	 */
 	void ExecutePredicateByCondition(TFunctionRef<void(UQuickTweenable*)> action, TFunctionRef<bool(const UQuickTweenable*)> predicate) const;
+
+	/** Find a registered tween by tag. O(k) in the number of tweens sharing the tag, allocation free.
+	 *
+	 * Tags follow FName rules (case-insensitive) and may form a dot-separated hierarchy like gameplay tags.
+	 *
+	 * @param tag - Tag to look up.
+	 * @param bMatchChildTags - If true, tweens tagged below the tag also match (e.g. "UI" matches "UI.Menu.Fade").
+	 * @return A pointer to the found tween or null otherwise.
+	 */
+	UQuickTweenable* FindTweenByTag(FName tag, bool bMatchChildTags = false) const;
+
+	/** Find all registered tweens by tag.
+	 *
+	 * @param tag - Tag to look up.
+	 * @param outTweens - Receives the matching tweens. Not reset.
+	 * @param bMatchChildTags - If true, tweens tagged below the tag also match.
+	 */
+	void FindAllTweensByTag(FName tag, TArray<UQuickTweenable*>& outTweens, bool bMatchChildTags = false) const;
+
+	/** Execute a function on all registered tweens with the given tag.
+	 *
+	 * @param tag - Tag to look up.
+	 * @param action - Function to execute on each matching tween. May create, kill or remove tweens.
+	 * @param bMatchChildTags - If true, tweens tagged below the tag also match.
+	 */
+	void ExecuteActionByTag(FName tag, TFunctionRef<void(UQuickTweenable*)> action, bool bMatchChildTags = false) const;
+
+	/** Kill every registered tween animating the target. O(k) in the number of tweens of the target.
+	 *
+	 * Tweens are killed automatically when the actor owning their target ends play, or once their target is garbage
+	 * collected (e.g. a component destroyed on its own, a widget or a material).
+	 *
+	 * @param target - Object the tweens were registered with, see UQuickTweenBase::SetTarget.
+	 * @return Number of tweens killed.
+	 */
+	int32 KillTweensOf(const UObject* target);
+
+	/**
+	 * Change the target of a tween, moving it in the target index while registered.
+	 *
+	 * @param tween - Tween to retarget.
+	 * @param target - New target, null to clear.
+	 */
+	void RetargetTween(UQuickTweenBase* tween, UObject* target);
+
+	/**
+	 * Index a tween, or the tweens of a sequence, that just joined a sequence under their targets, once the outermost
+	 * owning sequence is registered. Called by UQuickTweenSequence after taking ownership.
+	 *
+	 * @param tween - Tween or sequence now owned by a sequence.
+	 */
+	void TrackSequenceTween(UQuickTweenable* tween);
+
+	/**
+	 * Retarget a tween and record the property of the target it writes. Conflicts are resolved once the tween
+	 * plays (right away if it already does), see ResolvePropertyConflicts.
+	 *
+	 * @param tween - Tween writing the property.
+	 * @param target - Object owning the property.
+	 * @param channel - Written property, e.g. Location, Rotation, Scale, Opacity or a material parameter name.
+	 */
+	void ClaimProperty(UQuickTweenBase* tween, UObject* target, FName channel);
+
+	/**
+	 * Apply the conflict policy to the registered tweens playing or paused on the same target property as a tween
+	 * starting to play. O(k) in the number of tweens of the target. For a sequence every tween it owns is resolved,
+	 * tweens of the same sequence never conflict.
+	 *
+	 * A tween owned by another playing or paused sequence is resolved through that sequence: Kill and Complete apply
+	 * to the outermost sequence, Blend only stops the value writes of the owned tween.
+	 *
+	 * @param tween - Tween or sequence starting to play.
+	 */
+	void ResolvePropertyConflicts(UQuickTweenable* tween);
+
+	/**
+	 * Set how a tween starting to play on a target property treats the tweens already writing it. Defaults to Ignore.
+	 *
+	 * @param policy - Policy applied by the next claims.
+	 */
+	void SetConflictPolicy(EQuickTweenConflictPolicy policy) { ConflictPolicy = policy; }
+
+	/** Policy applied when a new tween claims a target property already written by other tweens. */
+	[[nodiscard]] EQuickTweenConflictPolicy GetConflictPolicy() const { return ConflictPolicy; }
+
+	/**
+	 * Create an empty group whose membership this manager maintains. The caller keeps it alive.
+	 *
+	 * @param name - Name of the group, for debugging.
+	 * @return The new group.
+	 */
+	UQuickTweenGroup* CreateGroup(FName name = NAME_None);
+
+	/**
+	 * Add a registered tween to a group, moving it out of its previous group. O(1).
+	 *
+	 * @param group - Group to join.
+	 * @param tween - Registered tween, see UQuickTweenable::GetTweenHandle.
+	 */
+	void AddToGroup(UQuickTweenGroup* group, UQuickTweenable* tween);
+
+	/**
+	 * Remove a tween from its group. O(1). Called automatically when the tween is unregistered.
+	 *
+	 * @param tween - Tween to remove.
+	 */
+	void RemoveFromGroup(UQuickTweenable* tween);
+
+	/**
+	 * Fill the pool of a tween class so the next allocations are served without NewObject.
+	 *
+	 * @param tweenClass - Concrete tween class to prewarm.
+	 * @param count - Desired number of free tweens of the class.
+	 */
+	void PrewarmPool(TSubclassOf<UQuickTweenable> tweenClass, int32 count);
+
+	/**
+	 * Reset a killed pooled tween and return it to the pool. Ignored for tweens not created by the pool.
+	 *
+	 * @param tween - Killed tween, must no longer be registered.
+	 */
+	void ReleaseToPool(UQuickTweenable* tween);
+
+	/** Pool statistics of a tween class, or null if the class was never pooled. */
+	[[nodiscard]] const FQuickTweenPoolStats* FindPoolStats(TSubclassOf<UQuickTweenable> tweenClass) const { return TweenPool.FindStats(tweenClass); }
+
+	/** Invoke func with the pool statistics of every pooled tween class. */
+	void ForEachPoolStats(TFunctionRef<void(const UClass*, const FQuickTweenPoolStats&)> func) const { TweenPool.ForEachStats(func); }
+
+	/** Approximate heap memory held by the manager containers in bytes, the tween objects themselves excluded. */
+	[[nodiscard]] SIZE_T GetAllocatedSize() const;
+
+	/**
+	 * Set the time scale of a channel, applied on top of each subscribed tween's own time scale. O(1), or O(n) in the
+	 * number of stored tweens while QuickTween.FixedStep is set, since pending steps are flushed at the previous scale.
+	 *
+	 * @param channel - Channel name, NAME_None for the default channel.
+	 * @param timeScale - New multiplier, 1 for normal speed.
+	 */
+	void SetTimeChannelScale(FName channel, float timeScale);
+
+	/**
+	 * Freeze or resume every tween subscribed to a channel. O(1). Frozen tweens keep their playing state.
+	 *
+	 * @param channel - Channel name, NAME_None for the default channel.
+	 * @param bPaused - Whether the channel is paused.
+	 */
+	void SetTimeChannelPaused(FName channel, bool bPaused);
+
+	/** Time scale of a channel, 1 if it was never set. */
+	[[nodiscard]] float GetTimeChannelScale(FName channel) const;
+
+	/** Whether a channel is paused. */
+	[[nodiscard]] bool IsTimeChannelPaused(FName channel) const;
+
+	/**
+	 * Replace the distance based update rate of tweens with a significance source, e.g. to drive it
+	 * from USignificanceManager. Pass an empty function to restore the distance based rate.
+	 *
+	 * @param hook - Receives the source component and returns the frames between updates (1 = every frame).
+	 */
+	void SetSignificanceHook(TFunction<int32(const USceneComponent*)> hook) { SignificanceHook = MoveTemp(hook); }
+
+	/** Frame budget report of the last frame tweens were updated in. Only covers the tick groups updated so far when read mid-frame. */
+	[[nodiscard]] const FQuickTweenBudgetStats& GetBudgetStats() const { return BudgetStats; }
+
+	/**
+	 * Create a native tween driven by a lambda receiving the eased alpha. No UObject is allocated.
+	 *
+	 * @param setter - Receives the eased alpha each update, exactly 0 or 1 on completion.
+	 * @param params - Timing settings and completion callback.
+	 * @return Handle to resolve the tween with FindNativeTween.
+	 */
+	FQuickNativeTweenHandle CreateNativeTween(TFunction<void(float)> setter, FQuickNativeTweenParams params = FQuickNativeTweenParams())
+	{
+		return NativeTweens.Add(MoveTemp(setter), MoveTemp(params));
+	}
+
+	/**
+	 * Create a native tween interpolating between two values. No UObject is allocated.
+	 *
+	 * @param from - Start value.
+	 * @param to - End value.
+	 * @param setter - Receives the interpolated value each update.
+	 * @param params - Timing settings and completion callback.
+	 * @return Handle to resolve the tween with FindNativeTween.
+	 */
+	template<typename T>
+	FQuickNativeTweenHandle CreateNativeTween(const T& from, const T& to, TFunction<void(const T&)> setter, FQuickNativeTweenParams params = FQuickNativeTweenParams())
+	{
+		return NativeTweens.Add<T>(from, to, MoveTemp(setter), MoveTemp(params));
+	}
+
+	/** Resolve a native tween handle, or null once the tween completed or was killed. Do not keep the pointer. */
+	[[nodiscard]] FQuickNativeTween* FindNativeTween(const FQuickNativeTweenHandle& handle) { return NativeTweens.Find(handle); }
+
+	/**
+	 * Queue the creation of a tween. Safe to call from any thread, lock free; the manager must outlive the caller's use of it.
+	 * The factory runs on the game thread at the start of the next Tick.
+	 *
+	 * @param factory - Creates and sets up the tween (e.g. UQuickVectorTween::CreateTween), receives the manager as world context.
+	 * @param onCreated - Optional, receives the handle of the created tween on the game thread.
+	 */
+	void EnqueueCreateTween(TFunction<UQuickTweenable*(UObject*)> factory, TFunction<void(const FQuickTweenHandle&)> onCreated = nullptr);
+
+	/** Queue Play on a tween from any thread, executed at the start of the next Tick. Stale handles are ignored. */
+	void EnqueuePlay(const FQuickTweenHandle& handle);
+
+	/** Queue Pause on a tween from any thread, executed at the start of the next Tick. Stale handles are ignored. */
+	void EnqueuePause(const FQuickTweenHandle& handle);
+
+	/** Queue Kill on a tween from any thread, executed at the start of the next Tick. Stale handles are ignored. */
+	void EnqueueKill(const FQuickTweenHandle& handle);
 private:
 
-	/** Array of active tweens managed by this subsystem. Transient so not serialized. */
+	/** Queue a command of the given type on a handle. */
+	void EnqueueHandleCommand(FQuickTweenCommand::EType type, const FQuickTweenHandle& handle);
+
+	/** Drain the command queue, in the order the commands were pushed per producer. */
+	void ExecuteCommands();
+
+	/** Advance, compute and apply the storage-backed tweens of a tick group. */
+	void UpdateStorageGroup(float deltaTime, int32 numFixedSteps, bool bIsWorldPaused, EQuickTweenTickGroup group);
+
+	/** Advance the Pipelined tweens and launch their math as a task, applied later by SyncPipeline. */
+	void LaunchPipeline(float deltaTime, int32 numFixedSteps, bool bIsWorldPaused);
+
+	/** Register a tick function for a group in the given engine tick group. */
+	void RegisterTickFunction(FQuickTweenManagerTickFunction& tickFunction, EQuickTweenTickGroup group, ETickingGroup tickingGroup, bool bIsPipelineSync);
+
+	/** Add the frame delta to the fixed step accumulator of a group and return the whole steps to advance, 0 when not in fixed step mode. */
+	int32 ConsumeFixedSteps(float deltaTime, EQuickTweenTickGroup group);
+
+	/** Frames between updates for a tween with a significance source. */
+	int32 ComputeUpdateInterval(const USceneComponent* source);
+
+	/** Register a tween immediately, assigning its slot. */
+	void RegisterTween(UQuickTweenable* tween);
+
+	/** Remove holes and killed tweens from both tween lists in a single pass each. */
+	void CompactTweens();
+
+	/** Register the tweens queued by AddTween during Tick. */
+	void FlushPendingAdds();
+
+	/** Invoke func on every registered and queued tween in registration order until it returns false. */
+	void ForEachTween(TFunctionRef<bool(UQuickTweenable*)> func) const;
+
+	/** Issue the tween handle and add the tween to the tag index under its tag and every parent tag. */
+	void TrackTween(UQuickTweenable* tween);
+
+	/** Release the tween handle and remove the tween from the tag index. */
+	void UntrackTween(UQuickTweenable* tween);
+
+	/** Add a tween to the target index and watch the actor owning its target. */
+	void TrackTarget(UQuickTweenable* tween);
+
+	/** Remove a tween from the target index. */
+	void UntrackTarget(UQuickTweenable* tween);
+
+	/** Let the tweens that yielded their property to the tween, or to a tween owned by the sequence, write again. */
+	void ReleasePropertyClaims(const UQuickTweenable* tween);
+
+	/** Add the tweens owned by a sequence, at any depth, to the sequence target index. */
+	void TrackSequenceTargets(UQuickTweenable* tween);
+
+	/** Remove the tweens owned by a sequence, at any depth, from the sequence target index. */
+	void UntrackSequenceTargets(UQuickTweenable* tween);
+
+	/** Kill the tweens of an actor and its components when it ends play. */
+	UFUNCTION()
+	void HandleTargetActorEndPlay(AActor* actor, EEndPlayReason::Type endPlayReason);
+
+	/** Kill the tweens whose target was garbage collected. Visits the non-actor targets and the watched actors, once
+	 * each, so components destroyed on their own and actors collected without ending play are covered too. */
+	void HandlePostGarbageCollect();
+
+	/** Whether an indexed tween satisfies a tag query made with the given key. */
+	static bool MatchesTagQuery(const UQuickTweenable* tween, FName tag, bool bMatchChildTags);
+
+	/** Batch used when no manager is available, writes go straight to the component. */
+	static FQuickTweenTransformBatch& GetPassThroughBatch();
+
+	/** Array of active tweenables that are not backed by the storage (e.g. sequences), null for removed slots.
+	 * Transient so not serialized. */
 	UPROPERTY(Transient)
 	TArray<UQuickTweenable*> QuickTweens = {};
 
+	/** Dense hot timing state of every registered UQuickTweenBase. */
+	UPROPERTY(Transient)
+	FQuickTweenStorage TweenStorage;
+
+	/** Tick functions per tick group, only registered for the groups in use. Index 0 (Default) is unused. */
+	FQuickTweenManagerTickFunction GroupTickFunctions[static_cast<int32>(EQuickTweenTickGroup::Num)];
+
+	/** Bit per group whose tick function couldn't be registered yet, retried by Tick. */
+	uint32 PendingTickGroupMask = 0;
+
+	/** Tick function applying the Pipelined pass in PostUpdateWork, registered with the Pipelined group. */
+	FQuickTweenManagerTickFunction PipelineSyncTickFunction;
+
+	/** Math of the Pipelined pass in flight, invalid once synced. */
+	UE::Tasks::FTask PipelineTask;
+
+	/** Tweens advanced by the Pipelined pass in flight. */
+	TArray<class UQuickTweenBase*> PipelineTweens;
+
+	/** Storage slots of PipelineTweens when advanced. */
+	TArray<int32> PipelineSlots;
+
+	/** Slot state copied for the Pipelined task, parallel to PipelineTweens. */
+	TArray<FQuickTweenComputeInput> PipelineInputs;
+
+	/** Pipelined task results, parallel to PipelineTweens. */
+	TArray<FQuickTweenComputedState> PipelineStates;
+
+	/** Transform writes queued during an update. */
+	FQuickTweenTransformBatch TransformBatch;
+
+	/** Native tweens, no UObject involved. */
+	FQuickNativeTweenStorage NativeTweens;
+
+	/** Recycled tweens per class. */
+	UPROPERTY(Transient)
+	FQuickTweenPool TweenPool;
+
+	/** Registered tweens keyed by their tag and each of its parent tags. Entries are removed on unregistration,
+	 * weak so a tween destroyed without unregistering never leaves a dangling entry. */
+	TMultiMap<FName, TWeakObjectPtr<UQuickTweenable>> TweensByTag;
+
+	/** Registered tweens keyed by their target. Weak on both sides, a key going stale marks its tweens for killing. */
+	TMultiMap<TWeakObjectPtr<const UObject>, TWeakObjectPtr<UQuickTweenable>> TweensByTarget;
+
+	/** Tweens owned by registered sequences keyed by their target, so conflicts with sequences are resolved too.
+	 * Entries are removed when the outermost sequence is unregistered. */
+	TMultiMap<TWeakObjectPtr<const UObject>, TWeakObjectPtr<UQuickTweenBase>> SequenceTweensByTarget;
+
+	/** Number of indexed tweens per target that is not an actor (e.g. components, widgets and materials), checked after
+	 * garbage collection since nothing reports their destruction. Actor targets are checked through WatchedActors. */
+	TMap<TWeakObjectPtr<const UObject>, int32> SweptTargets;
+
+	/** Policy applied by ClaimProperty. */
+	EQuickTweenConflictPolicy ConflictPolicy = EQuickTweenConflictPolicy::Ignore;
+
+	/** Actors whose EndPlay is bound, so each is bound once. */
+	TSet<TWeakObjectPtr<AActor>> WatchedActors;
+
+	/** Registration of HandlePostGarbageCollect. */
+	FDelegateHandle PostGarbageCollectHandle;
+
+	/** Scratch list of tweens advanced by the storage pass this frame. */
+	TArray<class UQuickTweenBase*> AdvancedTweens;
+
+	/** Storage slots of AdvancedTweens, only valid during the compute phase. */
+	TArray<int32> AdvancedSlots;
+
+	/** Compute phase results, parallel to AdvancedTweens. */
+	TArray<FQuickTweenComputedState> ComputedStates;
+
+	/** Frame budget report of the frame BudgetFrame. */
+	FQuickTweenBudgetStats BudgetStats;
+
+	/** Frame counter BudgetStats belongs to, the budget is shared by every tick group of a frame. */
+	uint64 BudgetFrame = 0;
+
+	/** Smoothed cost of advancing, computing and applying one tween, in milliseconds. */
+	float AverageTweenCostMs = 0.0f;
+
+	/** Time not yet advanced in fixed step mode, per tick group. */
+	double FixedStepAccumulators[static_cast<int32>(EQuickTweenTickGroup::Num)] = {};
+
+	/** Optional replacement of the distance based update rate. */
+	TFunction<int32(const USceneComponent*)> SignificanceHook;
+
+	/** Player view locations of the frame ViewLocationsFrame. */
+	TArray<FVector> ViewLocations;
+
+	/** Frame counter ViewLocations were gathered in. */
+	uint64 ViewLocationsFrame = 0;
+
+	/** Tweens added during Tick, registered once the pass is over. Entries removed meanwhile are skipped. */
+	TArray<UQuickTweenable*> PendingAdds;
+
+	/** Commands pushed by any thread, drained by the game thread at the start of Tick. */
+	TQueue<FQuickTweenCommand, EQueueMode::Mpsc> Commands;
+
+	/** Whether Tick is iterating the tween lists, so adds are queued and removals leave holes. */
+	bool bIsTicking = false;
+
 	/** Whether Initialize has been run for this manager instance. */
 	bool bIsInitialized = false;
 };
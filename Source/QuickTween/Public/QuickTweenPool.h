@@ -0,0 +1,107 @@
+﻿// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "QuickTweenPool.generated.h"
+
+class UQuickTweenable;
+
+/**
+ * Allocation statistics of a single pooled tween class.
+ */
+USTRUCT(BlueprintType)
+struct QUICKTWEEN_API FQuickTweenPoolStats
+{
+	GENERATED_BODY()
+
+	/** Tweens waiting in the pool to be reused. */
+	UPROPERTY(BlueprintReadOnly, Category = "QuickTween|Pool")
+	int32 NumFree = 0;
+
+	/** Tweens handed out and not yet returned. */
+	UPROPERTY(BlueprintReadOnly, Category = "QuickTween|Pool")
+	int32 NumActive = 0;
+
+	/** Highest NumActive observed, a good prewarm count for the class. */
+	UPROPERTY(BlueprintReadOnly, Category = "QuickTween|Pool")
+	int32 HighWaterMark = 0;
+
+	/** Tweens created with NewObject, including prewarmed ones. */
+	UPROPERTY(BlueprintReadOnly, Category = "QuickTween|Pool")
+	int32 NumAllocated = 0;
+
+	/** Tweens handed out from the free list instead of being created. */
+	UPROPERTY(BlueprintReadOnly, Category = "QuickTween|Pool")
+	int32 NumReused = 0;
+};
+
+/**
+ * Free list and statistics of a single pooled tween class.
+ */
+USTRUCT()
+struct QUICKTWEEN_API FQuickTweenPoolBucket
+{
+	GENERATED_BODY()
+
+	/** Reset tweens ready to be handed out. Referenced so they are not garbage collected. */
+	UPROPERTY()
+	TArray<UQuickTweenable*> Free;
+
+	/** Allocation statistics, NumFree mirrors Free.Num(). */
+	FQuickTweenPoolStats Stats;
+};
+
+/**
+ * Per-class recycling pool for tweens owned by a UQuickTweenManager.
+ *
+ * Killed tweens are reset and kept in a per-class free list instead of becoming
+ * garbage, then handed out again by the factories.
+ *
+ * Usage notes:
+ *  - Pooled tweens are created with the manager as outer so they never keep other objects alive.
+ *  - Only tweens handed out by Acquire are ever returned to the pool.
+ */
+USTRUCT()
+struct QUICKTWEEN_API FQuickTweenPool
+{
+	GENERATED_BODY()
+
+	/**
+	 * Hand out a tween of the given class, reused from the free list or created.
+	 *
+	 * @param tweenClass Concrete tween class.
+	 * @param outer Outer for newly created tweens.
+	 * @return The tween, in its default state.
+	 */
+	UQuickTweenable* Acquire(UClass* tweenClass, UObject* outer);
+
+	/**
+	 * Reset a killed tween and return it to the free list of its class.
+	 *
+	 * @param tween Tween previously handed out by Acquire.
+	 */
+	void Release(UQuickTweenable* tween);
+
+	/**
+	 * Create tweens until the free list of the class holds at least count entries.
+	 *
+	 * @param tweenClass Concrete tween class.
+	 * @param count Desired number of free tweens.
+	 * @param outer Outer for the created tweens.
+	 */
+	void Prewarm(UClass* tweenClass, int32 count, UObject* outer);
+
+	/** Statistics of a class, or null if it was never pooled. */
+	[[nodiscard]] const FQuickTweenPoolStats* FindStats(const UClass* tweenClass) const;
+
+	/** Invoke func with the statistics of every pooled class. */
+	void ForEachStats(TFunctionRef<void(const UClass*, const FQuickTweenPoolStats&)> func) const;
+
+	/** Drop every free tween, leaving them to the garbage collector. */
+	void Reset();
+
+	/** Buckets keyed by concrete tween class. */
+	UPROPERTY()
+	TMap<UClass*, FQuickTweenPoolBucket> Buckets;
+};
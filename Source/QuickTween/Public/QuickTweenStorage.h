@@ -0,0 +1,397 @@
+﻿// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Utils/CommonValues.h"
+#include "Utils/EaseType.h"
+#include "Utils/LoopType.h"
+#include "Utils/QuickTweenTiming.h"
+#include "Utils/QuickTweenTickGroup.h"
+#include "Utils/QuickTweenPriority.h"
+#include "QuickTweenStorage.generated.h"
+
+class UQuickTweenBase;
+class UCurveFloat;
+
+/**
+ * Boolean tween state packed into a single byte per storage slot.
+ */
+enum class EQuickTweenSlotFlags : uint8
+{
+	None = 0,
+	Reversed = 1 << 0,
+	PlayWhilePaused = 1 << 1,
+	AutoKill = 1 << 2,
+	ParallelCompute = 1 << 3,
+};
+ENUM_CLASS_FLAGS(EQuickTweenSlotFlags);
+
+/**
+ * Partition of the storage slots by what the manager has to do with them each frame.
+ */
+enum class EQuickTweenBucket : uint8
+{
+	Idle,
+	Playing,
+	PlayingWhilePaused,
+	Paused,
+	Completed,
+	Killed,
+	Num
+};
+
+/**
+ * Result of the compute phase for a single tween, consumed on the game thread.
+ */
+struct FQuickTweenComputedState
+{
+	/** Elapsed time the state was computed for, used to detect stale results. */
+	float ElapsedTime = 0.0f;
+
+	/** Loop index and raw alpha. */
+	FQuickTweenStateResult State;
+
+	/** Alpha mapped through the tween's easing. */
+	float EasedAlpha = 0.0f;
+
+	/** Whether the compute phase filled this entry. */
+	bool bIsComputed = false;
+};
+
+/**
+ * Copy of the slot state the compute phase reads, so it can run while the storage changes.
+ */
+struct FQuickTweenComputeInput
+{
+	/** Elapsed time of the slot. */
+	float ElapsedTime = 0.0f;
+
+	/** Time the value is rendered at, see FQuickTweenStorage::GetRenderTime. */
+	float RenderTime = 0.0f;
+
+	/** Duration of a single loop in seconds. */
+	float Duration = 0.0f;
+
+	/** Looping behavior. */
+	ELoopType LoopType = ELoopType::Restart;
+
+	/** Easing type. */
+	EEaseType EaseType = EEaseType::Linear;
+
+	/** Optional custom easing curve. */
+	const UCurveFloat* EaseCurve = nullptr;
+
+	/** Whether the slot opted into the parallel compute phase, the others are left uncomputed. */
+	bool bShouldCompute = false;
+};
+
+/**
+ * Time scale and pause state shared by every tween subscribed to a named time channel.
+ */
+struct FQuickTweenTimeChannel
+{
+	/** Channel name, NAME_None for the default channel. */
+	FName Name;
+
+	/** Multiplier applied on top of each tween's own time scale. */
+	float TimeScale = 1.0f;
+
+	/** Whether the tweens of the channel are frozen. */
+	bool bIsPaused = false;
+};
+
+/**
+ * Limit of an Advance pass under a frame budget, and what the pass left behind.
+ */
+struct FQuickTweenAdvanceBudget
+{
+	/** Maximum number of slots to advance, INDEX_NONE for no limit. Critical slots always advance and count against it. */
+	int32 MaxAdvanced = INDEX_NONE;
+
+	/** Number of playing slots skipped by the pass, their time stays accumulated. */
+	int32 NumDeferred = 0;
+
+	/** Largest time (seconds) a skipped slot has accumulated. */
+	float MaxDeferredTime = 0.0f;
+};
+
+/**
+ * Dense structure-of-arrays storage for the hot timing state of UQuickTweenBase instances.
+ *
+ * Every column is indexed by the same slot. A tween registered with the manager owns
+ * exactly one slot and reads/writes its timing state through it, so the manager can
+ * advance every playing tween in one linear pass without touching the UObjects.
+ *
+ * Slots are also partitioned into buckets by tick group and state (see EQuickTweenBucket) so
+ * each per-frame pass only visits the slots of its group that can advance, and compaction only
+ * the killed ones.
+ *
+ * Usage notes:
+ *  - Slots are removed with swap-and-pop; the tween moved into the freed slot is re-pointed.
+ *  - State must be written through SetState so the slot changes bucket.
+ *  - When a tween leaves the storage its state is copied back into the tween itself.
+ *  - Frame time is accumulated per slot and only folded into the elapsed time when the
+ *    slot is advanced, so slots skipped under a frame budget or a reduced update rate
+ *    catch up in one step. With a fixed step whole steps are accumulated instead and
+ *    folded one addition per step, so the elapsed time doesn't depend on the frame rate.
+ */
+USTRUCT()
+struct QUICKTWEEN_API FQuickTweenStorage
+{
+	GENERATED_BODY()
+
+	/**
+	 * Allocate a slot for the tween and copy its current timing state into it.
+	 *
+	 * @param tween Tween to attach. Must not already own a slot.
+	 * @return The slot index assigned to the tween.
+	 */
+	int32 Add(UQuickTweenBase* tween);
+
+	/**
+	 * Release a slot, copying its state back into the owning tween.
+	 *
+	 * @param slot Slot index to release.
+	 */
+	void RemoveAtSwap(int32 slot);
+
+	/**
+	 * Detach the tween of a slot without moving any other slot, copying its state back.
+	 * The slot is left empty and killed so the next compaction reclaims it.
+	 *
+	 * @param slot Slot index to release.
+	 */
+	void Release(int32 slot);
+
+	/** Release every slot, copying all state back into the owning tweens. */
+	void Reset();
+
+	/** Heap memory held by the columns and buckets, in bytes. */
+	[[nodiscard]] SIZE_T GetAllocatedSize() const;
+
+	/**
+	 * Write the state of a slot and move it to the matching bucket. O(1).
+	 *
+	 * @param slot Slot index to update.
+	 * @param newState New state.
+	 */
+	void SetState(int32 slot, EQuickTweenState newState);
+
+	/**
+	 * Move a slot to another tick group. O(1).
+	 *
+	 * @param slot Slot index to update.
+	 * @param group New tick group.
+	 */
+	void SetTickGroup(int32 slot, EQuickTweenTickGroup group);
+
+	/**
+	 * Find a time channel by name, adding it with a neutral scale if it doesn't exist yet.
+	 *
+	 * @param name Channel name, NAME_None for the default channel.
+	 * @return Index of the channel in TimeChannels.
+	 */
+	int32 FindOrAddTimeChannel(FName name);
+
+	/**
+	 * Subscribe a slot to a time channel.
+	 *
+	 * @param slot Slot index to update.
+	 * @param channel Index of the channel in TimeChannels.
+	 */
+	void SetTimeChannel(int32 slot, int32 channel);
+
+	/**
+	 * Set the budget priority of a slot.
+	 *
+	 * @param slot Slot index to update.
+	 * @param priority New priority.
+	 */
+	void SetPriority(int32 slot, EQuickTweenPriority priority) { Priority[slot] = priority; }
+
+	/**
+	 * Advance the elapsed time of the playing slots of a tick group. Only the playing buckets are visited.
+	 * Every playing slot accumulates the delta scaled by its time channel, computed once per channel;
+	 * slots of paused channels are skipped. Slots with a reduced update rate only advance on their
+	 * frames; then critical slots always advance and the rest are picked round-robin per priority class
+	 * until the budget is used up.
+	 *
+	 * @param deltaTime Frame delta in seconds, ignored when FixedStep is set.
+	 * @param numFixedSteps Whole steps to advance when FixedStep is set.
+	 * @param frame Frame counter, used to spread reduced-rate slots over frames.
+	 * @param bIsWorldPaused Whether the world is paused; only PlayWhilePaused slots advance in that case.
+	 * @param group Tick group to advance.
+	 * @param budget Limit of the pass, receives what was deferred.
+	 * @param outAdvanced Filled with the tweens whose time was advanced.
+	 * @param outAdvancedSlots Filled with the slots of outAdvanced, valid until a slot is added or removed.
+	 */
+	void Advance(float deltaTime, int32 numFixedSteps, uint64 frame, bool bIsWorldPaused, EQuickTweenTickGroup group, FQuickTweenAdvanceBudget& budget, TArray<UQuickTweenBase*>& outAdvanced, TArray<int32>& outAdvancedSlots);
+
+	/**
+	 * Compute loop, alpha and eased alpha of a slot. Pure math, safe to call from worker threads.
+	 *
+	 * @param slot Slot index to compute.
+	 * @param outComputed Receives the computed state.
+	 */
+	void Compute(int32 slot, FQuickTweenComputedState& outComputed) const;
+
+	/**
+	 * Copy the state Compute reads from a slot.
+	 *
+	 * @param slot Slot index to copy.
+	 * @param outInput Receives the slot state.
+	 */
+	void GatherComputeInput(int32 slot, FQuickTweenComputeInput& outInput) const;
+
+	/**
+	 * Compute loop, alpha and eased alpha from a copied slot state. Pure math, safe to call from worker threads.
+	 *
+	 * @param input Slot state gathered by GatherComputeInput.
+	 * @param outComputed Receives the computed state.
+	 */
+	static void Compute(const FQuickTweenComputeInput& input, FQuickTweenComputedState& outComputed);
+
+	/**
+	 * Time a slot is rendered at: its elapsed time, or RenderLag behind it clamped to the tween range when interpolating.
+	 *
+	 * @param slot Slot index to query.
+	 */
+	[[nodiscard]] float GetRenderTime(int32 slot) const;
+
+	/** Number of occupied slots. */
+	[[nodiscard]] int32 Num() const { return Tweens.Num(); }
+
+	/** Query a packed flag of the given slot. */
+	[[nodiscard]] bool HasFlag(int32 slot, EQuickTweenSlotFlags flag) const { return EnumHasAnyFlags(Flags[slot], flag); }
+
+	/** Set or clear a packed flag of the given slot. */
+	void SetFlag(int32 slot, EQuickTweenSlotFlags flag, bool bEnabled)
+	{
+		if (EnumHasAnyFlags(flag, EQuickTweenSlotFlags::Reversed))
+		{
+			// ... time accumulated so far was played in the previous direction
+			FlushAccumulatedDelta(slot);
+		}
+		bEnabled ? EnumAddFlags(Flags[slot], flag) : EnumRemoveFlags(Flags[slot], flag);
+		if (EnumHasAnyFlags(flag, EQuickTweenSlotFlags::PlayWhilePaused))
+		{
+			UpdateBucket(slot);
+		}
+	}
+
+	/** Slots of a tick group currently in a bucket, in no particular order. */
+	[[nodiscard]] const TArray<int32>& GetBucket(EQuickTweenBucket bucket, EQuickTweenTickGroup group) const
+	{
+		return Buckets[static_cast<int32>(group)][static_cast<int32>(bucket)];
+	}
+
+	/** Number of slots of a tick group currently in a bucket. */
+	[[nodiscard]] int32 NumInBucket(EQuickTweenBucket bucket, EQuickTweenTickGroup group) const { return GetBucket(bucket, group).Num(); }
+
+	/** Copy the hot state of a slot back into its tween and detach it. */
+	void Detach(int32 slot);
+
+	/** Fold the accumulated frame time of a slot into its elapsed time. */
+	void FlushAccumulatedDelta(int32 slot);
+
+	/** Bucket a slot belongs to given its state and flags. */
+	[[nodiscard]] EQuickTweenBucket ComputeBucket(int32 slot) const;
+
+	/** Move a slot to the bucket matching its state and flags. */
+	void UpdateBucket(int32 slot);
+
+	/** Append a slot to a bucket. */
+	void AddToBucket(int32 slot, EQuickTweenBucket bucket);
+
+	/** Swap-remove a slot from its current bucket. */
+	void RemoveFromBucket(int32 slot);
+
+	/** Tween owning each slot, null for released slots. Referenced so live tweens are kept alive by the manager. */
+	UPROPERTY()
+	TArray<UQuickTweenBase*> Tweens;
+
+	/** Current state of each slot. */
+	TArray<EQuickTweenState> State;
+
+	/** Packed boolean state of each slot. */
+	TArray<EQuickTweenSlotFlags> Flags;
+
+	/** Time elapsed since the tween started. */
+	TArray<float> ElapsedTime;
+
+	/** Duration of a single loop in seconds. */
+	TArray<float> Duration;
+
+	/** Time scale multiplier. */
+	TArray<float> TimeScale;
+
+	/** Number of loops (-1 = infinite). */
+	TArray<int32> Loops;
+
+	/** Current loop index (0-based). */
+	TArray<int32> CurrentLoop;
+
+	/** Looping behavior. */
+	TArray<ELoopType> LoopType;
+
+	/** Easing type. */
+	TArray<EEaseType> EaseType;
+
+	/** Optional custom easing curve. Kept alive by the owning tween. */
+	TArray<const UCurveFloat*> EaseCurve;
+
+	/** Tick group each slot is updated in. */
+	TArray<EQuickTweenTickGroup> TickGroup;
+
+	/** Budget priority of each slot. */
+	TArray<EQuickTweenPriority> Priority;
+
+	/** Frame time accumulated since the slot was last advanced, already scaled by its time channel but not by its own time scale. */
+	TArray<float> AccumulatedDelta;
+
+	/** Whole fixed steps accumulated since the slot was last advanced. */
+	TArray<int32> AccumulatedSteps;
+
+	/** Time channel index of each slot. */
+	TArray<int32> TimeChannel;
+
+	/** Frames between updates of each slot, 1 for every frame. */
+	TArray<uint8> UpdateInterval;
+
+	/** Frame offset of each slot so reduced-rate slots don't all update on the same frame. */
+	TArray<uint8> UpdatePhase;
+
+	/** Bucket each slot currently belongs to. */
+	TArray<EQuickTweenBucket> Bucket;
+
+	/** Position of each slot inside its bucket. */
+	TArray<int32> BucketIndex;
+
+	/** Slot lists per tick group and bucket. */
+	TArray<int32> Buckets[static_cast<int32>(EQuickTweenTickGroup::Num)][static_cast<int32>(EQuickTweenBucket::Num)];
+
+	/** Where the next budgeted pass starts, per tick group and priority class. */
+	int32 RoundRobinCursor[static_cast<int32>(EQuickTweenTickGroup::Num)][static_cast<int32>(EQuickTweenPriority::Num)] = {};
+
+	/** Named time channels, index 0 is the default channel. */
+	TArray<FQuickTweenTimeChannel> TimeChannels;
+
+	/** Channel index by name. */
+	TMap<FName, int32> TimeChannelIndices;
+
+	/** Scratch frame delta of each channel during Advance. */
+	TArray<float> ChannelDeltas;
+
+	/** Fixed timestep in seconds, 0 to advance by the frame delta. */
+	float FixedStep = 0.0f;
+
+	/** Unscaled time values are rendered behind the simulated time during a fixed step pass, 0 when not interpolating. */
+	float RenderLag = 0.0f;
+
+	/** Next UpdatePhase handed out. */
+	uint8 NextUpdatePhase = 0;
+
+	/** Scratch list of the budgeted slots of a pass, per priority class. */
+	TArray<int32> BudgetCandidates[static_cast<int32>(EQuickTweenPriority::Num)];
+};
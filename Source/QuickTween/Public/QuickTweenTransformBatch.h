@@ -0,0 +1,107 @@
+﻿// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "Utils/CommonValues.h"
+
+class USceneComponent;
+
+/**
+ * Location, rotation and scale writes queued for one scene component.
+ */
+struct FQuickTweenPendingTransform
+{
+	/** Component to write to. */
+	TWeakObjectPtr<USceneComponent> Component;
+
+	/** Pending location and the space it is expressed in. */
+	TOptional<FVector> Location;
+	EQuickTweenSpace LocationSpace = EQuickTweenSpace::WorldSpace;
+
+	/** Pending rotation and the space it is expressed in. */
+	TOptional<FRotator> Rotation;
+	EQuickTweenSpace RotationSpace = EQuickTweenSpace::WorldSpace;
+
+	/** Pending scale and the space it is expressed in. */
+	TOptional<FVector> Scale;
+	EQuickTweenSpace ScaleSpace = EQuickTweenSpace::WorldSpace;
+
+	/** Whether the location write sweeps. */
+	bool bSweep = false;
+
+	/** Teleport type of the location write. */
+	ETeleportType Teleport = ETeleportType::None;
+};
+
+/**
+ * Coalesces the transform writes tweens make to scene components during a manager update.
+ *
+ * Between Begin and Flush, location, rotation and scale writes are queued per component
+ * and flushed as a single SetWorldTransform / SetRelativeTransform, so a component moved,
+ * rotated and scaled by three tweens only propagates its transform once per update.
+ * Outside of a batch every write goes straight to the component.
+ *
+ * Usage notes:
+ *  - The last write of each part wins, as it would without batching.
+ *  - Reading the component transform before the flush (e.g. in an update event) returns the previous value.
+ *  - Parts written in different spaces are flushed with one call per part.
+ */
+struct QUICKTWEEN_API FQuickTweenTransformBatch
+{
+	/** Start queuing writes. */
+	void Begin() { bIsBatching = true; }
+
+	/** Write every queued transform and stop queuing. */
+	void Flush();
+
+	/** Whether writes are currently queued. */
+	[[nodiscard]] bool IsBatching() const { return bIsBatching; }
+
+	/**
+	 * Write or queue the location of a component.
+	 *
+	 * @param component Component to move.
+	 * @param location New location.
+	 * @param space Space the location is expressed in.
+	 * @param bSweep Whether to sweep to the new location.
+	 * @param teleport Whether physics state is teleported.
+	 */
+	void SetLocation(USceneComponent* component, const FVector& location, EQuickTweenSpace space, bool bSweep = false, ETeleportType teleport = ETeleportType::None);
+
+	/**
+	 * Write or queue the rotation of a component.
+	 *
+	 * @param component Component to rotate.
+	 * @param rotation New rotation.
+	 * @param space Space the rotation is expressed in.
+	 */
+	void SetRotation(USceneComponent* component, const FRotator& rotation, EQuickTweenSpace space);
+
+	/**
+	 * Write or queue the scale of a component.
+	 *
+	 * @param component Component to scale.
+	 * @param scale New scale.
+	 * @param space Space the scale is expressed in.
+	 */
+	void SetScale(USceneComponent* component, const FVector& scale, EQuickTweenSpace space);
+
+private:
+
+	/** Pending entry of a component, added if needed. */
+	FQuickTweenPendingTransform& FindOrAdd(USceneComponent* component);
+
+	/** Write a single pending entry. */
+	static void Write(const FQuickTweenPendingTransform& pending);
+
+	/** Pending writes in the order components were first written. */
+	TArray<FQuickTweenPendingTransform> Pending;
+
+	/** Index in Pending by component, only valid for the current batch. */
+	TMap<const USceneComponent*, int32> PendingIndices;
+
+	/** Whether writes are queued. */
+	bool bIsBatching = false;
+};
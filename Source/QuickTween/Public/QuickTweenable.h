@@ -5,9 +5,11 @@
 #include "CoreMinimal.h"
 #include "Utils/EaseType.h"
 #include "Utils/LoopType.h"
+#include "QuickTweenHandle.h"
 #include "QuickTweenable.generated.h"
 
 struct FQuickTweenEvaluatePayload;
+class UQuickTweenGroup;
 /**
  * Base UObject for QuickTween tweens.
  *
@@ -28,6 +30,9 @@ public:
 	/** Set the owning tween object for this tweenable. */
 	virtual void SetOwner(UQuickTweenable* owner);
 
+	/** Get the owning tween object, null when the tweenable isn't owned by a sequence. */
+	[[nodiscard]] virtual UQuickTweenable* GetOwner() const;
+
 	/** Start or resume playback of the tween.
 	 */
 	UFUNCTION(BlueprintCallable, Category= "Tween|Control")
@@ -131,6 +136,10 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (Keywords = "Tween"), Category = "Tween|Info")
 	[[nodiscard]] virtual FString GetTweenTag() const;
 
+	/** Get the user-assigned tag as an FName. Allocation free, used by the manager tag index. */
+	UFUNCTION(BlueprintCallable, meta = (Keywords = "Tween"), Category = "Tween|Info")
+	[[nodiscard]] virtual FName GetTweenTagName() const;
+
 	/** Get the current loop index (0-based) the tween is on.
 	 * @return 0 for the first loop, 1 for the second, etc.
 	 */
@@ -144,6 +153,42 @@ public:
 	/** Whether the tween should continue running even when the game is paused. */
 	UFUNCTION(BlueprintCallable, Category= "Tween|Info")
 	[[nodiscard]] virtual bool GetShouldPlayWhilePaused() const;
+
+	/** Get the generational handle issued by the manager. Unset if the tween was never registered,
+	 * stale once it is killed or removed from the manager.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "Tween | Handle"), Category= "Tween|Info")
+	[[nodiscard]] FQuickTweenHandle GetTweenHandle() const { return TweenHandle; }
+
+	/** Get the group this tween belongs to, or null if it is in none. */
+	UFUNCTION(BlueprintCallable, BlueprintPure, meta = (Keywords = "Tween | Group"), Category= "Tween|Info")
+	[[nodiscard]] UQuickTweenGroup* GetTweenGroup() const;
+
+protected:
+
+	/** Return the tween to its default state before it is handed out again by the manager pool.
+	 * Implementations must clear delegates, cached values and state, and drop references to other objects.
+	 */
+	virtual void ResetForReuse();
+
+private:
+	friend class UQuickTweenManager;
+	friend struct FQuickTweenPool;
+
+	/** Handle issued when registered with the manager. */
+	FQuickTweenHandle TweenHandle;
+
+	/** Whether this tween was handed out by the manager pool and goes back to it once killed. */
+	bool bIsPooled = false;
+
+	/** Index of this tweenable in the manager's tween list, INDEX_NONE when not registered there. */
+	int32 ManagerSlot = INDEX_NONE;
+
+	/** Group this tween belongs to, maintained by the manager. */
+	TWeakObjectPtr<UQuickTweenGroup> Group;
+
+	/** Index of this tweenable in the members of its group, INDEX_NONE when in none. */
+	int32 GroupSlot = INDEX_NONE;
 };
 
 
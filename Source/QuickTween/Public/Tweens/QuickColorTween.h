@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "QuickTweenBase.h"
+#include "QuickTweenManager.h"
 #include "QuickColorTween.generated.h"
 
 class UQuickColorTween;
@@ -101,7 +102,7 @@ public:
 			return nullptr;
 		}
 		
-		UQuickColorTween* tween = NewObject<UQuickColorTween>(worldContextObject);
+		UQuickColorTween* tween = UQuickTweenManager::NewTween<UQuickColorTween>(worldContextObject);
 		tween->SetUp(
 			worldContextObject,
 			MoveTemp(from),
@@ -132,12 +133,14 @@ public:
 	UFUNCTION(BlueprintPure, meta = (Keywords = "Tween"), Category = "Tween|Info")
 	[[nodiscard]] FColor GetEndValue() const { return EndValue.Get(FColor::White); }
 protected:
-	virtual void ApplyAlphaValue(float alpha) override;
+	virtual void ApplyEasedAlphaValue(float easedAlpha) override;
 
 	virtual void HandleOnStart() override;
 
 	virtual void HandleOnComplete() override;
 
+	virtual void ResetForReuse() override;
+
 private:
 	/** Starting function returning FColor. */
 	FNativeColorGetter From;
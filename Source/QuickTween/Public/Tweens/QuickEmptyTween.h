@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "QuickTweenBase.h"
+#include "QuickTweenManager.h"
 #include "QuickEmptyTween.generated.h"
 
 
@@ -66,7 +67,7 @@ public:
 		bool bShouldPlayWhilePaused = false,
 		bool bShouldAutoPlay = false)
 	{
-		UQuickEmptyTween* tween = NewObject<UQuickEmptyTween>(worldContextObject);
+		UQuickEmptyTween* tween = UQuickTweenManager::NewTween<UQuickEmptyTween>(worldContextObject);
 		tween->SetUp(
 			worldContextObject,
 			duration,
@@ -77,5 +78,5 @@ public:
 		return tween;
 	}
 protected:
-	virtual void ApplyAlphaValue(float alpha) override;
+	virtual void ApplyEasedAlphaValue(float easedAlpha) override;
 };
\ No newline at end of file
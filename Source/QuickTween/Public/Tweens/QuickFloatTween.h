@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "QuickTweenBase.h"
+#include "QuickTweenManager.h"
 #include "QuickFloatTween.generated.h"
 
 class UQuickFloatTween;
@@ -100,7 +101,7 @@ public:
 			return nullptr;
 		}
 		
-		UQuickFloatTween* tween = NewObject<UQuickFloatTween>(worldContextObject);
+		UQuickFloatTween* tween = UQuickTweenManager::NewTween<UQuickFloatTween>(worldContextObject);
 		tween->SetUp(
 			worldContextObject,
 			MoveTemp(from),
@@ -131,12 +132,14 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (Keywords = "Tween"), Category= "Tween|Info")
 	[[nodiscard]] float GetEndValue() const { return EndValue.Get(0.0f); }
 protected:
-	virtual void ApplyAlphaValue(float alpha) override;
+	virtual void ApplyEasedAlphaValue(float easedAlpha) override;
 
 	virtual void HandleOnStart() override;
 
 	virtual void HandleOnComplete() override;
 
+	virtual void ResetForReuse() override;
+
 private:
 	/** Starting function returning float. */
 	FNativeFloatGetter From;
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "QuickTweenBase.h"
+#include "QuickTweenManager.h"
 #include "QuickIntTween.generated.h"
 
 class UQuickIntTween;
@@ -100,7 +101,7 @@ public:
 			return nullptr;
 		}
 		
-		UQuickIntTween* tween = NewObject<UQuickIntTween>(worldContextObject);
+		UQuickIntTween* tween = UQuickTweenManager::NewTween<UQuickIntTween>(worldContextObject);
 		tween->SetUp(
 			worldContextObject,
 			MoveTemp(from),
@@ -131,12 +132,14 @@ public:
 	UFUNCTION(BlueprintPure, meta = (Keywords = "Tween"), Category= "Tween|Info")
 	[[nodiscard]] int32 GetEndValue() const { return EndValue.Get(0); }
 protected:
-	virtual void ApplyAlphaValue(float alpha) override;
+	virtual void ApplyEasedAlphaValue(float easedAlpha) override;
 
 	virtual void HandleOnStart() override;
 
 	virtual void HandleOnComplete() override;
 
+	virtual void ResetForReuse() override;
+
 private:
 	/** Starting function returning int32. */
 	FNativeIntGetter From;
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "QuickTweenBase.h"
+#include "QuickTweenManager.h"
 #include "QuickRotatorTween.generated.h"
 
 class UQuickRotatorTween;
@@ -106,7 +107,7 @@ public:
 			return nullptr;
 		}
 		
-		UQuickRotatorTween* tween = NewObject<UQuickRotatorTween>(worldContextObject);
+		UQuickRotatorTween* tween = UQuickTweenManager::NewTween<UQuickRotatorTween>(worldContextObject);
 		tween->SetUp(
 			worldContextObject,
 			MoveTemp(from),
@@ -138,12 +139,14 @@ public:
 	UFUNCTION(BlueprintPure, meta = (Keywords = "Tween"), Category = "Tween|Info")
 	[[nodiscard]] FRotator GetEndValue() const { return EndValue.Get(FRotator::ZeroRotator); }
 protected:
-	virtual void ApplyAlphaValue(float alpha) override;
+	virtual void ApplyEasedAlphaValue(float easedAlpha) override;
 
 	virtual void HandleOnStart() override;
 
 	virtual void HandleOnComplete() override;
 
+	virtual void ResetForReuse() override;
+
 private:
 	/** Starting value or function returning FRotator. */
 	FNativeRotatorGetter From;
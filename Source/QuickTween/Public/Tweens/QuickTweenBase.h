@@ -5,12 +5,18 @@
 #include "CoreMinimal.h"
 #include "CommonValues.h"
 #include "QuickTweenable.h"
+#include "QuickTweenStorage.h"
 #include "../Utils/EaseType.h"
 #include "../Utils/LoopType.h"
+#include "../Utils/QuickTweenTiming.h"
+#include "../Utils/QuickTweenTickGroup.h"
+#include "../Utils/QuickTweenPriority.h"
+#include "Components/SceneComponent.h"
 #include "QuickTweenBase.generated.h"
 
 class UQuickTweenSequence;
 class UQuickTweenBase;
+class UQuickTweenManager;
 
 DEFINE_LOG_CATEGORY_STATIC(LogQuickTweenBase, Log, All);
 
@@ -41,6 +47,7 @@ public:
 	 * @param bShouldAutoKill Whether to auto-kill the tween on completion.
 	 * @param bShouldPlayWhilePaused Whether the tween should play while the game is paused.
 	 * @param bShouldAutoPlay Whether the tween should start playing immediately.
+	 * @param timeChannel Manager time channel the tween follows, NAME_None for the default channel.
 	 */
 	void SetUp(
 		const UObject* worldContextObject,
@@ -53,10 +60,13 @@ public:
 		const FString& tweenTag = FString(),
 		bool bShouldAutoKill = true,
 		bool bShouldPlayWhilePaused = false,
-		bool bShouldAutoPlay = false);
+		bool bShouldAutoPlay = false,
+		FName timeChannel = NAME_None);
 
 	virtual void SetOwner(UQuickTweenable* owner) override { Owner = owner; }
 
+	[[nodiscard]] virtual UQuickTweenable* GetOwner() const override { return Owner; }
+
 #pragma endregion
 
 #pragma region Tween Control
@@ -83,7 +93,7 @@ public:
 #pragma region Tween State Queries
 public:
 
-	[[nodiscard]] virtual bool GetIsPendingKill() const override { return TweenState == EQuickTweenState::Kill; }
+	[[nodiscard]] virtual bool GetIsPendingKill() const override { return GetTweenState() == EQuickTweenState::Kill; }
 
 	[[nodiscard]] virtual float GetLoopDuration() const override { return Duration;}
 
@@ -96,15 +106,18 @@ public:
 		return GetLoopDuration() * GetLoops() / GetTimeScale();
 	}
 
-	[[nodiscard]] virtual float GetElapsedTime() const override { return ElapsedTime; }
+	[[nodiscard]] virtual float GetElapsedTime() const override { return IsInStorage() ? Storage->ElapsedTime[StorageSlot] : ElapsedTime; }
 
 	[[nodiscard]] virtual float GetTimeScale() const override { return TimeScale; }
 
-	[[nodiscard]] virtual bool GetIsPlaying() const override { return TweenState == EQuickTweenState::Play; }
+	[[nodiscard]] virtual bool GetIsPlaying() const override { return GetTweenState() == EQuickTweenState::Play; }
+
+	[[nodiscard]] virtual bool GetIsCompleted() const override { return GetTweenState() == EQuickTweenState::Complete; }
 
-	[[nodiscard]] virtual bool GetIsCompleted() const override { return TweenState == EQuickTweenState::Complete; }
+	/** Current state, read from the storage slot when attached. */
+	[[nodiscard]] EQuickTweenState GetTweenState() const { return IsInStorage() ? Storage->State[StorageSlot] : TweenState; }
 
-	[[nodiscard]] virtual bool GetIsReversed() const override { return bIsReversed; }
+	[[nodiscard]] virtual bool GetIsReversed() const override { return IsInStorage() ? Storage->HasFlag(StorageSlot, EQuickTweenSlotFlags::Reversed) : bIsReversed; }
 
 	[[nodiscard]] virtual EEaseType GetEaseType() const override { return EaseType; }
 
@@ -114,17 +127,140 @@ public:
 
 	[[nodiscard]] virtual ELoopType GetLoopType() const override { return LoopType; }
 
-	[[nodiscard]] virtual FString GetTweenTag() const override { return TweenTag; }
+	[[nodiscard]] virtual FString GetTweenTag() const override { return TweenTag.IsNone() ? FString() : TweenTag.ToString(); }
 
-	[[nodiscard]] virtual int32 GetCurrentLoop() const override { return CurrentLoop; }
+	[[nodiscard]] virtual FName GetTweenTagName() const override { return TweenTag; }
+
+	[[nodiscard]] virtual int32 GetCurrentLoop() const override { return IsInStorage() ? Storage->CurrentLoop[StorageSlot] : CurrentLoop; }
 
 	[[nodiscard]] virtual bool GetAutoKill() const override { return bAutoKill; }
 
 	[[nodiscard]] virtual bool GetShouldPlayWhilePaused() const override {return bPlayWhilePaused;}
 
 	[[nodiscard]] bool GetSnapToEndOnComplete() const { return bSnapToEndOnComplete; }
+
+	/** Whether the tween is writing its final value on completion, for setters that must not skip that write. */
+	[[nodiscard]] bool GetIsCompleting() const { return bIsCompleting; }
+
+	/** Whether the manager computes this tween's loop, alpha and easing in its parallel phase. */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Info")
+	[[nodiscard]] bool GetComputeInParallel() const { return bComputeInParallel; }
+
+	/** When in the frame the manager updates this tween. */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Info")
+	[[nodiscard]] EQuickTweenTickGroup GetTickGroup() const { return TickGroup; }
+
+	/** How important it is to update this tween every frame when the manager frame budget is exceeded. */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Info")
+	[[nodiscard]] EQuickTweenPriority GetPriority() const { return Priority; }
+
+	/** Component whose distance to the players decides how often this tween is updated, null for every frame. */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Info")
+	[[nodiscard]] USceneComponent* GetSignificanceSource() const { return SignificanceSource.Get(); }
+
+	/** Manager time channel this tween follows, NAME_None for the default channel. */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Info")
+	[[nodiscard]] FName GetTimeChannel() const { return TimeChannel; }
+
+	/** Object this tween animates, killed along with it. Null when the tween has no target. */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Info")
+	[[nodiscard]] UObject* GetTarget() const { return Target.Get(); }
+
+	/** Property of the target this tween writes (e.g. Location, Opacity or a material parameter), NAME_None if unclaimed. */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Info")
+	[[nodiscard]] FName GetPropertyChannel() const { return PropertyChannel; }
+
+	/** Whether a newer tween on the same target property took it over under the Blend conflict policy, so this one
+	 * skips its value writes until that tween is removed. */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Info")
+	[[nodiscard]] bool GetHasYieldedProperty() const { return !YieldedTo.IsExplicitlyNull() && YieldedTo.IsValid(); }
+
+	/** Whether value writes are skipped while the significance source is not rendered. */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Info")
+	[[nodiscard]] bool GetCullWhenNotRendered() const { return bCullWhenNotRendered; }
 #pragma endregion
 
+	/**
+	 * Opt this tween in or out of the manager's parallel compute phase.
+	 * When enabled, loop index, alpha and eased alpha are computed on worker threads and
+	 * only the setter and events run on the game thread. Subclasses must implement
+	 * ApplyEasedAlphaValue to support it.
+	 * @param bEnable Whether to compute this tween in parallel.
+	 */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Control")
+	void SetComputeInParallel(bool bEnable);
+
+	/**
+	 * Choose when in the frame the manager updates this tween.
+	 * E.g. PrePhysics for movement feeding physics in the same frame, PostUpdateWork for cosmetic tweens,
+	 * Pipelined to take the math off the game thread's critical path when control calls may lag a frame.
+	 * @param group Tick group to update the tween in.
+	 */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Control")
+	void SetTickGroup(EQuickTweenTickGroup group);
+
+	/**
+	 * Choose how important it is to update this tween every frame when the manager frame budget
+	 * (QuickTween.FrameBudgetMs) is exceeded. Critical tweens always update, lower classes may be
+	 * skipped for a few frames and catch up once updated again.
+	 * @param priority Priority class of the tween.
+	 */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Control")
+	void SetPriority(EQuickTweenPriority priority);
+
+	/**
+	 * Follow a manager time channel (e.g. UI, Gameplay, Cinematic). The channel scale multiplies the tween's
+	 * own time scale and pausing the channel freezes the tween; see UQuickTweenManager::SetTimeChannelScale.
+	 * @param channel Channel name, NAME_None for the default channel.
+	 */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Control")
+	void SetTimeChannel(FName channel);
+
+	/**
+	 * Change the speed of this tween, e.g. from UQuickTweenGroup::SetTimeScale. Time already played keeps its scale.
+	 * @param timeScale New speed multiplier, 1 for normal speed. Must be positive.
+	 */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Control")
+	void SetTimeScale(float timeScale);
+
+	/**
+	 * Let the manager lower the update rate of this tween while the component is far from every player
+	 * (see QuickTween.LOD.BaseDistance and UQuickTweenManager::SetSignificanceHook). Skipped frames are
+	 * accumulated so the tween keeps its timing. Set automatically by the SceneComponent library functions.
+	 * @param source Component to measure, null to always update every frame.
+	 */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Control")
+	void SetSignificanceSource(USceneComponent* source);
+
+	/**
+	 * Register the object this tween animates with the manager. For actors and their components the tween is killed
+	 * when the actor ends play, otherwise once the target is garbage collected; see UQuickTweenManager::KillTweensOf.
+	 * Set automatically by the library functions animating a component, widget or material.
+	 * @param target Animated object, null to clear.
+	 */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Control")
+	void SetTarget(UObject* target);
+
+	/**
+	 * Register the target and the property of it this tween writes. Once this tween plays, running tweens on the same
+	 * target and channel are resolved with the manager conflict policy; see UQuickTweenManager::ResolvePropertyConflicts.
+	 * Set automatically by the library functions animating a component, widget or material.
+	 * @param target Animated object.
+	 * @param channel Written property, e.g. Location, Rotation, Scale, Opacity or a material parameter name.
+	 */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Control")
+	void SetTargetProperty(UObject* target, FName channel);
+
+	/**
+	 * Skip value writes while the significance source was not recently rendered (the primitive itself,
+	 * or the owning actor for other scene components). Time keeps advancing, so the first update once
+	 * visible writes the current value in one go, and completion always writes the final value.
+	 * Meant for cosmetic tweens; has no effect without a significance source.
+	 * @param bEnable Whether to cull the tween while not rendered.
+	 */
+	UFUNCTION(BlueprintCallable, Category= "Tween|Control")
+	void SetCullWhenNotRendered(bool bEnable) { bCullWhenNotRendered = bEnable; }
+
 	bool InstigatorIsOwner(const UQuickTweenable* instigator) const { return instigator == Owner; }
 	
 	bool HasOwner() const { return Owner != nullptr; }
@@ -223,10 +359,25 @@ protected:
 
 	/**
 	 * Apply the interpolated alpha value to the tweened property.
+	 * By default eases the alpha and forwards it to ApplyEasedAlphaValue.
 	 * @param alpha Interpolated alpha value (0.0 to 1.0).
 	 */
 	virtual void ApplyAlphaValue(float alpha);
 
+	/**
+	 * Apply an alpha that was already mapped through the tween easing.
+	 * Used directly when the easing was computed in the manager's parallel phase.
+	 * @param easedAlpha Eased alpha value, may overshoot [0, 1] for some easings.
+	 */
+	virtual void ApplyEasedAlphaValue(float easedAlpha);
+
+	/**
+	 * Map a raw alpha through the tween easing (curve if set, ease type otherwise).
+	 * @param alpha Raw alpha value (0.0 to 1.0).
+	 * @return The eased alpha.
+	 */
+	[[nodiscard]] float EaseAlpha(float alpha) const { return FQuickTweenTiming::EaseAlpha(alpha, GetEaseType(), GetEaseCurve()); }
+
 	/**
 	 * Called when the tween transitions to the Start state.
 	 *
@@ -249,13 +400,11 @@ protected:
 	 * perform any necessary cleanup and invoke killed events.
 	 */
 	virtual void HandleOnKill();
-private:
 
-	struct FQuickTweenStateResult
-	{
-		int32 Loop = 0;
-		float Alpha = 0.0f;
-	};
+	virtual void ResetForReuse() override;
+private:
+	friend struct FQuickTweenStorage;
+	friend class UQuickTweenManager;
 
 
 	/**
@@ -268,6 +417,93 @@ private:
 	 */
 	FQuickTweenStateResult ComputeTweenState(float time) const;
 
+	/**
+	 * Resolve loop events, completion and value application for the current elapsed time.
+	 * Called by Update after advancing time, or directly by the manager once its storage
+	 * pass has advanced the time of every playing tween.
+	 */
+	void UpdateFromElapsedTime();
+
+	/**
+	 * Resolve the update from a state produced by the manager's compute phase.
+	 * Falls back to UpdateFromElapsedTime if the elapsed time changed since it was computed.
+	 *
+	 * @param computed State computed for this tween in the parallel phase.
+	 */
+	void UpdateFromComputedState(const FQuickTweenComputedState& computed);
+
+	/**
+	 * Shared tail of the update: loop events, completion check, value application and update event.
+	 *
+	 * @param state Loop index and raw alpha for the current elapsed time.
+	 * @param easedAlpha Eased alpha when already computed, unset to ease on the game thread.
+	 */
+	void ResolveUpdate(const FQuickTweenStateResult& state, TOptional<float> easedAlpha);
+
+	/** Run HandleOnComplete with bIsCompleting set. */
+	void ApplyCompletion();
+
+	/** Whether value writes are skipped this update because the significance source is offscreen. */
+	[[nodiscard]] bool IsCulled() const;
+
+	/** Whether this tween writes its value this update, i.e. it is neither culled nor yielded its property. */
+	[[nodiscard]] bool ShouldWriteValue() const { return !GetHasYieldedProperty() && !IsCulled(); }
+
+	/** Whether the hot timing state currently lives in a manager storage slot. */
+	[[nodiscard]] bool IsInStorage() const { return Storage != nullptr; }
+
+	/** Write the current state to the storage slot when attached (moving it between the manager buckets), or locally otherwise. */
+	void SetTweenState(EQuickTweenState newState)
+	{
+		if (IsInStorage())
+		{
+			Storage->SetState(StorageSlot, newState);
+		}
+		else
+		{
+			TweenState = newState;
+		}
+	}
+
+	/** Write the elapsed time to the storage slot when attached, or locally otherwise. */
+	void SetElapsedTime(float time)
+	{
+		if (IsInStorage())
+		{
+			Storage->ElapsedTime[StorageSlot] = time;
+		}
+		else
+		{
+			ElapsedTime = time;
+		}
+	}
+
+	/** Write the current loop to the storage slot when attached, or locally otherwise. */
+	void SetCurrentLoop(int32 loop)
+	{
+		if (IsInStorage())
+		{
+			Storage->CurrentLoop[StorageSlot] = loop;
+		}
+		else
+		{
+			CurrentLoop = loop;
+		}
+	}
+
+	/** Write the reversed flag to the storage slot when attached, or locally otherwise. */
+	void SetIsReversed(bool bReversed)
+	{
+		if (IsInStorage())
+		{
+			Storage->SetFlag(StorageSlot, EQuickTweenSlotFlags::Reversed, bReversed);
+		}
+		else
+		{
+			bIsReversed = bReversed;
+		}
+	}
+
 	/**
 	 * Request a state transition for this tween.
 	 *
@@ -278,10 +514,16 @@ private:
 	 */
 	bool RequestStateTransition(EQuickTweenState newState);
 
-	/** Current state of the tween. */
+	/** Manager storage holding the hot timing state while registered, nullptr when detached. */
+	FQuickTweenStorage* Storage = nullptr;
+
+	/** Index of this tween inside Storage. */
+	int32 StorageSlot = INDEX_NONE;
+
+	/** Current state of the tween. Only authoritative while detached from the storage. */
 	EQuickTweenState TweenState = EQuickTweenState::Idle;
 
-	/** Time elapsed since the tween started. */
+	/** Time elapsed since the tween started. Only authoritative while detached from the storage. */
 	float ElapsedTime = 0.0f;
 
 	/** Duration of the loop in seconds. */
@@ -299,6 +541,9 @@ private:
 	/** Whether to snap to the end value upon completion. */
 	bool bSnapToEndOnComplete = true;
 
+	/** True while HandleOnComplete runs. */
+	bool bIsCompleting = false;
+
 	/** Whether to trigger events during state changes. */
 	bool bTriggerEvents = true;
 
@@ -319,7 +564,7 @@ private:
 	ELoopType LoopType = ELoopType::Restart;
 
 	/** Optional tag for identifying the tween. */
-	FString TweenTag = FString();
+	FName TweenTag = NAME_None;
 
 	/** If this tween has an owner */
 	UPROPERTY()
@@ -331,6 +576,36 @@ private:
 	/** If the tween should play while the game is paused. */
 	bool bPlayWhilePaused = false;
 
+	/** If the tween opted into the manager's parallel compute phase. */
+	bool bComputeInParallel = false;
+
+	/** When in the frame the manager updates this tween. */
+	EQuickTweenTickGroup TickGroup = EQuickTweenTickGroup::Default;
+
+	/** Priority class under the manager frame budget. */
+	EQuickTweenPriority Priority = EQuickTweenPriority::Normal;
+
+	/** Manager time channel the tween follows. */
+	FName TimeChannel = NAME_None;
+
+	/** Component measured to pick the update rate. */
+	TWeakObjectPtr<USceneComponent> SignificanceSource;
+
+	/** Animated object, indexed by the manager while the tween is registered. */
+	TWeakObjectPtr<UObject> Target;
+
+	/** Property of the target the tween writes, resolved against other tweens by the manager conflict policy. */
+	FName PropertyChannel = NAME_None;
+
+	/** Tween the property was yielded to under the Blend policy, value writes are skipped while it is set. */
+	TWeakObjectPtr<UQuickTweenBase> YieldedTo;
+
+	/** If value writes are skipped while the significance source is not rendered. */
+	bool bCullWhenNotRendered = false;
+
 	UPROPERTY()
 	const UObject* WorldContextObject = nullptr;
+
+	/** Manager resolved from the world context on SetUp, so setters reach its transform batch without a lookup. */
+	TWeakObjectPtr<UQuickTweenManager> Manager;
 };
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "CommonValues.h"
 #include "QuickTweenable.h"
+#include "QuickTweenManager.h"
 #include "UObject/Object.h"
 #include "../Utils/LoopType.h"
 #include "QuickTweenSequence.generated.h"
@@ -87,7 +88,7 @@ public:
 		bool bShouldAutoKill = true,
 		bool bShouldPlayWhilePaused = false)
 	{
-		UQuickTweenSequence* sequence = NewObject<UQuickTweenSequence>(worldContextObject);
+		UQuickTweenSequence* sequence = UQuickTweenManager::NewTween<UQuickTweenSequence>(worldContextObject);
 		sequence->SetUp(
 			worldContextObject,
 			loops,
@@ -115,6 +116,8 @@ public:
 	UQuickTweenSequence* Append(UQuickTweenable* tween);
 
 	virtual void SetOwner(UQuickTweenable* owner) override { Owner = owner; }
+
+	[[nodiscard]] virtual UQuickTweenable* GetOwner() const override { return Owner; }
 #pragma endregion
 
 #pragma region Sequence Control
@@ -145,6 +148,8 @@ public:
 
 	[[nodiscard]] virtual bool GetIsPlaying() const override { return SequenceState == EQuickTweenState::Play;}
 
+	[[nodiscard]] EQuickTweenState GetTweenState() const { return SequenceState; }
+
 	[[nodiscard]] virtual float GetTimeScale() const override { return 1.0f; }
 
 	[[nodiscard]] virtual bool GetIsReversed() const override { return bIsReversed; }
@@ -176,7 +181,9 @@ public:
 
 	[[nodiscard]] virtual ELoopType GetLoopType() const override { return LoopType; }
 
-	[[nodiscard]] virtual FString GetTweenTag() const override { return SequenceTweenId; }
+	[[nodiscard]] virtual FString GetTweenTag() const override { return SequenceTweenId.IsNone() ? FString() : SequenceTweenId.ToString(); }
+
+	[[nodiscard]] virtual FName GetTweenTagName() const override { return SequenceTweenId; }
 
 	[[nodiscard]] virtual bool GetShouldPlayWhilePaused() const override { return bPlayWhilePaused; }
 
@@ -195,6 +202,9 @@ public:
 	UFUNCTION(BlueprintCallable, meta = (Keywords = "Sequence"), Category = "Sequence|State")
 	[[nodiscard]] UQuickTweenable* GetTween(int32 index) const;
 
+	/** Invoke func on every tween of the sequence in order, nested sequences included but not entered. */
+	void ForEachTween(TFunctionRef<void(UQuickTweenable*)> func) const;
+
 #pragma endregion
 
 #pragma region Delegates
@@ -291,6 +301,11 @@ public:
 	FNativeDelegateTweenSequence OnLoop;
 #pragma endregion
 
+protected:
+
+	/** Reset the sequence for the manager pool, returning pooled child tweens to the pool as well. */
+	virtual void ResetForReuse() override;
+
 private:
 
 	struct FQuickTweenSequenceStateResult
@@ -394,7 +409,7 @@ private:
 	ELoopType LoopType = ELoopType::Restart;
 
 	/** Identifier for the sequence. */
-	FString SequenceTweenId;
+	FName SequenceTweenId = NAME_None;
 
 	/** If the sequence should be eliminated from the manager when completed. */
 	bool bAutoKill = true;
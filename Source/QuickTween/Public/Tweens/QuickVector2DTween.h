@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "QuickTweenBase.h"
+#include "QuickTweenManager.h"
 #include "QuickVector2DTween.generated.h"
 
 class UQuickVector2DTween;
@@ -101,7 +102,7 @@ public:
 			return nullptr;
 		}
 		
-		UQuickVector2DTween* tween = NewObject<UQuickVector2DTween>(worldContextObject);
+		UQuickVector2DTween* tween = UQuickTweenManager::NewTween<UQuickVector2DTween>(worldContextObject);
 		tween->SetUp(
 			worldContextObject,
 			MoveTemp(from),
@@ -132,12 +133,14 @@ public:
 	UFUNCTION(BlueprintPure, meta = (Keywords = "Tween"), Category = "Tween|Info")
 	[[nodiscard]] FVector2D GetEndValue() const { return EndValue.Get(FVector2D::ZeroVector); }
 protected:
-	virtual void ApplyAlphaValue(float alpha) override;
+	virtual void ApplyEasedAlphaValue(float easedAlpha) override;
 
 	virtual void HandleOnStart() override;
 
 	virtual void HandleOnComplete() override;
 
+	virtual void ResetForReuse() override;
+
 private:
 	/** Starting function returning FVector. */
 	FNativeVector2DGetter From;
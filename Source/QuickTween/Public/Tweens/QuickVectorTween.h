@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "QuickTweenBase.h"
+#include "QuickTweenManager.h"
 #include "QuickVectorTween.generated.h"
 
 class UQuickVectorTween;
@@ -101,7 +102,7 @@ public:
 			return nullptr;
 		}
 
-		UQuickVectorTween* tween = NewObject<UQuickVectorTween>(worldContextObject);
+		UQuickVectorTween* tween = UQuickTweenManager::NewTween<UQuickVectorTween>(worldContextObject);
 		tween->SetUp(
 			worldContextObject,
 			MoveTemp(from),
@@ -133,12 +134,14 @@ public:
 	[[nodiscard]] FVector GetEndValue() const { return EndValue.Get(FVector::ZeroVector); }
 
 protected:
-	virtual void ApplyAlphaValue(float alpha) override;
+	virtual void ApplyEasedAlphaValue(float easedAlpha) override;
 
 	virtual void HandleOnStart() override;
 
 	virtual void HandleOnComplete() override;
 
+	virtual void ResetForReuse() override;
+
 private:
 	/** Starting function returning FVector. */
 	FNativeVectorGetter From;
@@ -24,6 +24,41 @@ enum class EQuickTweenSpace : uint8
 	LocalSpace UMETA(DisplayName = "Local Space")
 };
 
+/**
+ *  Enum defining how movement tweens write the location of a scene component.
+ *  - NoSweep: Move without collision checks, for decorative meshes.
+ *  - Sweep: Sweep for collision every write.
+ *  - SweepEveryNFrames: Sweep every QuickTween.SweepInterval frames, staggered per tween, and on the final write.
+ *    Move without collision checks otherwise.
+ *  - TeleportPhysics: Move without collision checks and teleport the physics state instead of moving it.
+ */
+UENUM(BlueprintType)
+enum class EQuickTweenMovePolicy : uint8
+{
+	NoSweep UMETA(DisplayName = "No Sweep"),
+	Sweep UMETA(DisplayName = "Sweep"),
+	SweepEveryNFrames UMETA(DisplayName = "Sweep Every N Frames"),
+	TeleportPhysics UMETA(DisplayName = "Teleport Physics")
+};
+
+/**
+ *  Enum defining what happens to a playing or paused tween when another one starts playing on the same target property.
+ *  - KillPrevious: Kill the running tween, the new one starts from the current value.
+ *  - CompletePrevious: Complete the running tween so it writes its final value first. Infinite loops are killed instead.
+ *  - Blend: Keep the running tween alive with its events but stop its value writes until the new one is removed,
+ *    the new one takes over from the current value.
+ *  - Ignore: Keep both tweens writing, the last writer wins. The default.
+ *  A running tween owned by a sequence is killed or completed through its outermost sequence.
+ */
+UENUM(BlueprintType)
+enum class EQuickTweenConflictPolicy : uint8
+{
+	KillPrevious UMETA(DisplayName = "Kill Previous"),
+	CompletePrevious UMETA(DisplayName = "Complete Previous"),
+	Blend UMETA(DisplayName = "Blend"),
+	Ignore UMETA(DisplayName = "Ignore")
+};
+
 /**
  *  Enum defining the current state of a QuickTween.
  */
@@ -0,0 +1,22 @@
+// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "QuickTweenPriority.generated.h"
+
+/**
+ * Enum representing how important it is to update a tween every frame when the manager frame budget is exceeded.
+ * - Critical: Always updated.
+ * - Normal: Updated round-robin with the budget left after the critical tweens.
+ * - Cosmetic: Updated round-robin with the budget left after the normal tweens.
+ * Skipped tweens keep their frame time and catch up the next time they are updated.
+ */
+UENUM(BlueprintType)
+enum class EQuickTweenPriority : uint8
+{
+	Critical UMETA(DisplayName = "Critical"),
+	Normal UMETA(DisplayName = "Normal"),
+	Cosmetic UMETA(DisplayName = "Cosmetic"),
+	Num UMETA(Hidden),
+};
@@ -0,0 +1,45 @@
+// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "QuickTweenTickGroup.generated.h"
+
+/**
+ * Enum representing when in the frame a tween is updated.
+ * - Default: With the manager tickable, after the world tick groups.
+ * - PrePhysics / DuringPhysics / PostPhysics / PostUpdateWork: In the matching engine tick group,
+ *   e.g. PrePhysics so movement tweens feed the physics step of the same frame.
+ * - Pipelined: Time is advanced at the start of PrePhysics and the math runs as a task alongside physics and
+ *   the actor ticks; setters and events are applied in PostUpdateWork. Control calls made in between
+ *   (pause, kill, ...) take effect on the next frame's pass.
+ */
+UENUM(BlueprintType)
+enum class EQuickTweenTickGroup : uint8
+{
+	Default UMETA(DisplayName = "Default"),
+	PrePhysics UMETA(DisplayName = "Pre Physics"),
+	DuringPhysics UMETA(DisplayName = "During Physics"),
+	PostPhysics UMETA(DisplayName = "Post Physics"),
+	PostUpdateWork UMETA(DisplayName = "Post Update Work"),
+	Pipelined UMETA(DisplayName = "Pipelined"),
+	Num UMETA(Hidden),
+};
+
+/** Engine tick group matching a tween tick group, where Pipelined starts its pass. Default has no tick group of its own. */
+inline ETickingGroup ToTickingGroup(EQuickTweenTickGroup group)
+{
+	switch (group)
+	{
+	case EQuickTweenTickGroup::PrePhysics:
+	case EQuickTweenTickGroup::Pipelined:
+		return TG_PrePhysics;
+	case EQuickTweenTickGroup::DuringPhysics:
+		return TG_DuringPhysics;
+	case EQuickTweenTickGroup::PostPhysics:
+		return TG_PostPhysics;
+	default:
+		return TG_PostUpdateWork;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+﻿// Copyright 2025 Juan Pablo Hernandez Mosti. All Rights Reserved.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Curves/CurveFloat.h"
+#include "EaseFunctions.h"
+#include "EaseType.h"
+#include "LoopType.h"
+
+/**
+ * Loop index and raw (un-eased) alpha of a tween at a given time.
+ */
+struct FQuickTweenStateResult
+{
+	int32 Loop = 0;
+	float Alpha = 0.0f;
+};
+
+/**
+ * @class FQuickTweenTiming
+ * @brief Pure timing rules shared by every tween flavour.
+ *
+ * Stateless and free of UObject access (except the optional read-only ease curve),
+ * so it can be evaluated from worker threads.
+ */
+struct FQuickTweenTiming
+{
+    /**
+     * \brief Compute the loop index and alpha for a given time.
+     *
+     * \param Time Elapsed time in seconds, may be negative or past the last loop.
+     * \param LoopDuration Duration of a single loop in seconds.
+     * \param LoopType Looping behavior, PingPong inverts odd loops.
+     * \return Loop index and alpha in [0, 1].
+     */
+    static FORCEINLINE FQuickTweenStateResult ComputeState(float Time, float LoopDuration, ELoopType LoopType)
+    {
+        FQuickTweenStateResult Result;
+
+        Result.Loop = FMath::FloorToInt(Time / LoopDuration);
+
+        float LocalTime = FMath::Fmod(Time, LoopDuration);
+
+        if (Result.Loop != 0 && FMath::IsNearlyZero(LocalTime))
+        {
+            LocalTime = LoopDuration;
+        }
+
+        if (LocalTime < 0.f)
+        {
+            LocalTime += LoopDuration;
+        }
+
+        Result.Alpha = LocalTime / LoopDuration;
+        if (LoopType == ELoopType::PingPong && (Result.Loop & 1) != 0) // ... odd loop, backward traversal
+        {
+            Result.Alpha = 1.f - Result.Alpha;
+        }
+
+        return Result;
+    }
+
+    /**
+     * \brief Map a raw alpha through the easing function.
+     *
+     * Interpolating with TEaseLerp using the returned value yields the same result as
+     * FEaseFunctions<T>::Ease with the raw alpha.
+     *
+     * \param Alpha Raw alpha in [0, 1].
+     * \param EaseType Built-in easing, ignored when EaseCurve is set.
+     * \param EaseCurve Optional custom curve.
+     * \return Eased alpha, may overshoot [0, 1] for some easings.
+     */
+    static FORCEINLINE float EaseAlpha(float Alpha, EEaseType EaseType, const UCurveFloat* EaseCurve)
+    {
+        return EaseCurve ?
+            FEaseFunctions<float>::Ease(0.f, 1.f, Alpha, EaseCurve) :
+            FEaseFunctions<float>::Ease(0.f, 1.f, Alpha, EaseType);
+    }
+};
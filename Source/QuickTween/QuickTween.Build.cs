@@ -48,6 +48,7 @@ public class QuickTween : ModuleRules
 				"Slate",
 				"SlateCore",
 				"UMG",
+				"TraceLog",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);